@@ -1,14 +1,14 @@
-#pragma once
-
-#include "camy/base.hpp"
-#include "camy/init.hpp"
-#include "camy/features.hpp"
-
-#include "camy/gpu_backend.hpp"
-#include "camy/layer_dispatcher.hpp"
-#include "camy/pipeline_cache.hpp"
-#include "camy/common_structs.hpp"
-#include "camy/layers.hpp"
-#include "camy/resource_storer.hpp"
-#include "camy/resources.hpp"
+#pragma once
+
+#include "camy/base.hpp"
+#include "camy/init.hpp"
+#include "camy/features.hpp"
+
+#include "camy/gpu_backend.hpp"
+#include "camy/layer_dispatcher.hpp"
+#include "camy/pipeline_cache.hpp"
+#include "camy/common_structs.hpp"
+#include "camy/layers.hpp"
+#include "camy/resource_storer.hpp"
+#include "camy/resources.hpp"
 #include "camy/shader.hpp"
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+// camy
+#include "../base.hpp"
+#include "../com_utils.hpp"
+#include "paged_linear_allocator.hpp"
+
+namespace camy
+{
+	namespace allocators
+	{
+		/*
+			Class: FrameArena
+				Scratch memory whose lifetime is a frame. Each thread allocates from its own PagedLinearAllocator
+				( identified by thread_index, usually the same index used for the Queue recorders ) thus no locking
+				is required. There is one set of allocators per frame in flight, next_frame() moves to the
+				next set and resets it, memory allocated during frame N is valid until next_frame() has been
+				called num_frames_in_flight times. Pages are kept around, once the working set has been reached
+				allocating is just bumping an offset.
+				next_frame() and the statistics are not thread safe, they have to be called when nobody is allocating
+		*/
+		template <Size page_size>
+		class FrameArena final
+		{
+		public:
+			static const u32 max_threads{ 16 };
+			static const u32 max_frames_in_flight{ 4 };
+
+			/*
+				Constructor: FrameArena
+					No memory is allocated until a thread allocates for the first time
+			*/
+			FrameArena(u32 num_frames_in_flight = 2);
+
+			/*
+				Destructor: ~FrameArena
+					Releases all the pages, memory allocated from the arena is invalidated
+			*/
+			~FrameArena();
+
+			FrameArena(const FrameArena& other) = delete;
+			FrameArena& operator=(const FrameArena& other) = delete;
+
+			/*
+				Function: next_frame
+					Begins a new frame, recycling the memory of the frame num_frames_in_flight frames ago
+			*/
+			void next_frame();
+
+			/*
+				Function: allocate
+					Allocates size bytes for the current frame, thread_index has to be < max_threads.
+					See PagedLinearAllocator::allocate for alignment
+			*/
+			void* allocate(u32 thread_index, Size size, Size alignment = 16);
+
+			/*
+				Function: allocate<T>
+					Allocates and constructs a Type, destructors are never called
+			*/
+			template <typename Type, typename ...CtorArgs>
+			Type* allocate(u32 thread_index, CtorArgs&&... ctor_args);
+
+			/*
+				Function: allocate_array
+					Allocates count default constructed Types
+			*/
+			template <typename Type>
+			Type* allocate_array(u32 thread_index, u32 count);
+
+			/*
+				Function: get_allocated_size
+					Bytes allocated by all the threads in the current frame
+			*/
+			Size get_allocated_size()const;
+
+			/*
+				Function: get_high_water_mark
+					Biggest amount of memory allocated by all the threads in a single frame
+			*/
+			Size get_high_water_mark()const;
+
+			u32 get_num_frames_in_flight()const { return m_num_frames_in_flight; }
+
+		private:
+			// Allocators are written by their own thread only, padding avoids false sharing
+			struct ThreadArena
+			{
+				PagedLinearAllocator<page_size>* allocator{ nullptr };
+
+				Byte padding[camy_cache_line_size];
+			};
+
+			ThreadArena m_arenas[max_frames_in_flight][max_threads];
+			u32	 m_num_frames_in_flight;
+			u32	 m_frame;
+			Size m_high_water_mark;
+		};
+	}
+}
+
+#include "frame_arena.inl"
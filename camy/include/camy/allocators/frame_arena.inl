@@ -0,0 +1,104 @@
+namespace camy
+{
+	namespace allocators
+	{
+		template <Size page_size>
+		FrameArena<page_size>::FrameArena(u32 num_frames_in_flight) :
+			m_num_frames_in_flight{ num_frames_in_flight },
+			m_frame{ 0 },
+			m_high_water_mark{ 0 }
+		{
+			if (m_num_frames_in_flight == 0 || m_num_frames_in_flight > max_frames_in_flight)
+			{
+				camy_warning("Invalid number of frames in flight: ", num_frames_in_flight, " has to be in [1, ", static_cast<u32>(max_frames_in_flight), "] defaulting to 2");
+				m_num_frames_in_flight = 2;
+			}
+		}
+
+		template <Size page_size>
+		FrameArena<page_size>::~FrameArena()
+		{
+			for (auto f{ 0u }; f < max_frames_in_flight; ++f)
+			{
+				for (auto t{ 0u }; t < max_threads; ++t)
+					safe_release(m_arenas[f][t].allocator);
+			}
+		}
+
+		template <Size page_size>
+		void FrameArena<page_size>::next_frame()
+		{
+			// Frame that is being completed might be the biggest one
+			auto allocated_size{ get_allocated_size() };
+			if (allocated_size > m_high_water_mark)
+				m_high_water_mark = allocated_size;
+
+			m_frame = (m_frame + 1) % m_num_frames_in_flight;
+
+			for (auto t{ 0u }; t < max_threads; ++t)
+			{
+				if (m_arenas[m_frame][t].allocator != nullptr)
+					m_arenas[m_frame][t].allocator->reset();
+			}
+		}
+
+		template <Size page_size>
+		void* FrameArena<page_size>::allocate(u32 thread_index, Size size, Size alignment)
+		{
+			camy_assert(thread_index < max_threads, { return nullptr; }, "Thread index: ", thread_index, " is out of range, max threads: ", static_cast<u32>(max_threads));
+
+			auto& arena{ m_arenas[m_frame][thread_index] };
+
+			// First allocation of this thread in this frame slot
+			if (arena.allocator == nullptr)
+				arena.allocator = new PagedLinearAllocator<page_size>();
+
+			return arena.allocator->allocate(size, alignment);
+		}
+
+		template <Size page_size>
+		template <typename Type, typename ...CtorArgs>
+		Type* FrameArena<page_size>::allocate(u32 thread_index, CtorArgs&&... ctor_args)
+		{
+			auto memory{ allocate(thread_index, sizeof(Type), alignof(Type)) };
+			if (memory == nullptr)
+				return nullptr;
+
+			return new (memory) Type(std::forward<CtorArgs>(ctor_args)...);
+		}
+
+		template <Size page_size>
+		template <typename Type>
+		Type* FrameArena<page_size>::allocate_array(u32 thread_index, u32 count)
+		{
+			auto memory{ static_cast<Type*>(allocate(thread_index, sizeof(Type) * count, alignof(Type))) };
+			if (memory == nullptr)
+				return nullptr;
+
+			for (auto i{ 0u }; i < count; ++i)
+				new (memory + i) Type();
+
+			return memory;
+		}
+
+		template <Size page_size>
+		Size FrameArena<page_size>::get_allocated_size()const
+		{
+			Size allocated_size{ 0 };
+			for (auto t{ 0u }; t < max_threads; ++t)
+			{
+				if (m_arenas[m_frame][t].allocator != nullptr)
+					allocated_size += m_arenas[m_frame][t].allocator->get_allocated_size();
+			}
+
+			return allocated_size;
+		}
+
+		template <Size page_size>
+		Size FrameArena<page_size>::get_high_water_mark()const
+		{
+			auto allocated_size{ get_allocated_size() };
+			return allocated_size > m_high_water_mark ? allocated_size : m_high_water_mark;
+		}
+	}
+}
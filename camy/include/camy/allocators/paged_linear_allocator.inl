@@ -1,126 +1,120 @@
-namespace camy
-{
-	namespace allocators
-	{
-		template <Size page_size>
-		PagedLinearAllocator<page_size>::PagedLinearAllocator(u32 alignment) : 
-			m_alignment{ alignment }
-		{
-			if ((m_alignment & 0x1))
-			{
-				camy_warning("Alignment: ", m_alignment, "is not valid, has to be a power of two, defaulting to 2");
-				m_alignment = 2;
-			}
-
-			m_current_page = new (_aligned_malloc(sizeof(Page<page_size>), m_alignment)) Page<page_size>;
-
-			// Offset at compile time can indeed be done, but requires some little yet ugly hacks, if aligned is not 
-			// respected it currently isnt a problem, just warning the use
-			if (((void*)m_current_page != (void*)&(m_current_page->buffer)))
-			{
-				camy_warning("Page buffer is not at offset 0 this will result in unaligned allocation");
-			}
-		}
-
-		template <Size page_size>
-		PagedLinearAllocator<page_size>::~PagedLinearAllocator()
-		{
-			// When freeing memory we have to be sure m_current_page points to the first page
-			reset();
-
-			auto current_page{ m_current_page };
-			do
-			{
-				auto to_delete{ current_page };
-		 
-				if (current_page != nullptr)
-					current_page = m_current_page->next;
-				
-				// Deleting current page
-				_aligned_free(to_delete);
-			} while (current_page != nullptr);
-		}
-
-		template <Size page_size>
-		void* PagedLinearAllocator<page_size>::allocate(Size size)
-		{
-			camy_assert(size <= page_size, { return nullptr; }, "Can't allocate an item bigger than a page");
-			camy_assert(m_current_page != nullptr, { return nullptr; }, "Invalid current page");
-
-			// Do we still have space in the current page
-			auto current_index{ m_current_page->next_free };
-			auto next_index{ m_current_page->next_free + size };
-			if (next_index < page_size)
-			{
-				m_current_page->next_free = next_index;
-				return reinterpret_cast<void*>(&m_current_page->buffer[current_index]);
-			}
-
-			// We don't, now can we reuse a previously allocated page ? 
-			if (m_current_page->next != nullptr)
-			{
-				m_current_page = m_current_page->next;
-				m_current_page->next_free += size;
-				return reinterpret_cast<void*>(&m_current_page->buffer[0]);
-			}
-
-			// Unfortunately we have to allocate a new page
-			m_current_page->next = new (_aligned_malloc(sizeof(Page<page_size>), m_alignment)) Page<page_size>;
-			m_current_page->next->previous = m_current_page; // back link
-			m_current_page = m_current_page->next;
-			m_current_page->next_free += size;
-			return reinterpret_cast<void*>(&m_current_page->buffer[0]);
-		}
-
-		template <Size page_size>
-		template <typename Type, typename ...CtorArgs>
-		Type* PagedLinearAllocator<page_size>::allocate(CtorArgs&&... ctor_args)
-		{
-			auto size{ sizeof(Type) };
-
-			camy_assert(size <= page_size, { return nullptr; }, "Can't allocate an item bigger than a page itself");
-			camy_assert(m_current_page != nullptr, { return nullptr; } "Invalid current page");
-
-			// Do we still have space in the current page
-			auto current_index{ m_current_page->next_free };
-			auto next_index{ m_current_page->next_free + size };
-			if (next_index < page_size)
-			{
-				m_current_page->next_free = next_index;
-				return new (reinterpret_cast<Type*>(&m_current_page->buffer[current_index])) Type(std::forward<CtorArgs>(ctor_args)...);
-			}
-
-			// We don't, now can we reuse a previously allocated page ? 
-			if (m_current_page->next != nullptr)
-			{
-				m_current_page = m_current_page->next;
-				m_current_page->next_free += size;
-				return new (reinterpret_cast<Type*>(&m_current_page->buffer[0])) Type(std::forward<CtorArgs>(ctor_args)...);
-			}
-
-			// Unfortunately we have to allocate a new page
-			m_current_page->next = new Page<page_size>;
-			m_current_page->next->previous = m_current_page;
-			m_current_page = m_current_page->next;
-			m_current_page->next_free += size;
-			return new (reinterpret_cast<Type*>(&m_current_page->buffer[0])) Type(std::forward<CtorArgs>(ctor_args)...);
-		}
-
-		template <Size page_size>
-		void PagedLinearAllocator<page_size>::reset()
-		{
-			camy_assert(m_current_page != nullptr, { return; }, "Invalid current page");
-
-			// Looping backwards from current one and setting all to 0 
-			m_current_page->next_free = 0;
-			auto current{ m_current_page };
-			while (current->previous != nullptr)
-			{
-				current->previous->next_free = 0;
-				current = current->previous;
-			}
-
-			m_current_page = current;
-		}
-	}
+namespace camy
+{
+	namespace allocators
+	{
+		template <Size page_size>
+		PagedLinearAllocator<page_size>::PagedLinearAllocator(u32 alignment) : 
+			m_alignment{ alignment },
+			m_allocated_size{ 0 },
+			m_high_water_mark{ 0 },
+			m_num_pages{ 0 }
+		{
+			if (m_alignment == 0 || (m_alignment & (m_alignment - 1)))
+			{
+				camy_warning("Alignment: ", m_alignment, "is not valid, has to be a power of two, defaulting to 2");
+				m_alignment = 2;
+			}
+
+			m_current_page = _allocate_page();
+
+			// Offset at compile time can indeed be done, but requires some little yet ugly hacks, if aligned is not 
+			// respected it currently isnt a problem, just warning the use
+			if (((void*)m_current_page != (void*)&(m_current_page->buffer)))
+			{
+				camy_warning("Page buffer is not at offset 0 this will result in unaligned allocation");
+			}
+		}
+
+		template <Size page_size>
+		PagedLinearAllocator<page_size>::~PagedLinearAllocator()
+		{
+			// When freeing memory we have to be sure m_current_page points to the first page
+			reset();
+
+			auto current_page{ m_current_page };
+			while (current_page != nullptr)
+			{
+				auto to_delete{ current_page };
+				current_page = current_page->next;
+				
+				// Deleting current page
+				to_delete->~Page<page_size>();
+				_aligned_free(to_delete);
+			}
+		}
+
+		template <Size page_size>
+		void* PagedLinearAllocator<page_size>::allocate(Size size, Size alignment)
+		{
+			camy_assert(m_current_page != nullptr, { return nullptr; }, "Invalid current page");
+			camy_assert(alignment != 0 && !(alignment & (alignment - 1)), { return nullptr; }, "Alignment has to be a power of two | ", alignment);
+
+			// Worst case padding is needed for alignments bigger than the page's one
+			const Size max_padding{ alignment > m_alignment ? alignment - m_alignment : 0 };
+			camy_assert(size + max_padding <= page_size, { return nullptr; }, "Can't allocate an item bigger than a page");
+
+			// Do we still have space in the current page ? If not we try to reuse the following page
+			// and eventually allocate a new one
+			while (true)
+			{
+				auto base{ reinterpret_cast<PointerSize>(&m_current_page->buffer[0]) };
+				auto current{ base + m_current_page->next_free };
+				auto aligned{ (current + alignment - 1) & ~static_cast<PointerSize>(alignment - 1) };
+
+				if (aligned + size <= base + page_size)
+				{
+					m_allocated_size += (aligned + size) - current;
+					m_current_page->next_free = (aligned + size) - base;
+					return reinterpret_cast<void*>(aligned);
+				}
+
+				if (m_current_page->next == nullptr)
+				{
+					m_current_page->next = _allocate_page();
+					m_current_page->next->previous = m_current_page; // back link
+				}
+				
+				m_current_page = m_current_page->next;
+			}
+		}
+
+		template <Size page_size>
+		template <typename Type, typename ...CtorArgs>
+		Type* PagedLinearAllocator<page_size>::allocate(CtorArgs&&... ctor_args)
+		{
+			auto memory{ allocate(sizeof(Type), alignof(Type)) };
+			if (memory == nullptr)
+				return nullptr;
+
+			return new (memory) Type(std::forward<CtorArgs>(ctor_args)...);
+		}
+
+		template <Size page_size>
+		void PagedLinearAllocator<page_size>::reset()
+		{
+			camy_assert(m_current_page != nullptr, { return; }, "Invalid current page");
+
+			if (m_allocated_size > m_high_water_mark)
+				m_high_water_mark = m_allocated_size;
+			m_allocated_size = 0;
+
+			// Looping backwards from current one and setting all to 0 
+			m_current_page->next_free = 0;
+			auto current{ m_current_page };
+			while (current->previous != nullptr)
+			{
+				current->previous->next_free = 0;
+				current = current->previous;
+			}
+
+			m_current_page = current;
+		}
+
+		template <Size page_size>
+		Page<page_size>* PagedLinearAllocator<page_size>::_allocate_page()
+		{
+			++m_num_pages;
+			return new (_aligned_malloc(sizeof(Page<page_size>), m_alignment)) Page<page_size>;
+		}
+	}
 }
\ No newline at end of file
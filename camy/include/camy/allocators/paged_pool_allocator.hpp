@@ -1,82 +1,132 @@
-#pragma once
-
-#include "page.hpp"
-
-namespace camy
-{
-	namespace allocators
-	{
-		template <typename Type, u32 count>
-		struct TypedReusablePage : public Page<sizeof(Type) * count>
-		{
-			static_assert(count > 0, "Can't created a page with size 0");
-			static_assert(sizeof(Type) >= sizeof(u32), "Typed pages element size has to be > 32 bit");
-
-			union StoredType
-			{
-				~StoredType() { data.~Type() }
-				Type data;
-				u32  next_free;
-			};
-
-			static_assert(sizeof(StoredType) == sizeof(Type), "Segmentation faults will occur if this condition is not verified");
-
-			TypedReusablePage();
-
-			template <typename ...CtorArgs>
-			Type* allocate(CtorArgs&&... ctor_args);
-
-			void deallocate(Type* ptr);
-
-			u32 m_next_free{ 0 };
-			u32 m_free_count{ count };
-		};
-
-		/*
-			Class: PagedPoolAllocator
-				Typed pool allocator that allows to reuse pointers ( it is not index-based ), it uses
-				reusable pages. 
-				
-				Type is the type of the pool ( since it's tpe
-		*/
-		template <typename Type, u32 count = 10>
-		class PagedPoolAllocator final
-		{
-			static_assert(count > 0, "Can't created a pool allocator with page size 0");
-		public:
-			/*
-				Constructor: PagedPoolAllocator
-					Constructs a new instance preallocating one page
-			*/
-			PagedPoolAllocator(u32 alignment = 16);
-
-			/*
-				Destuctor: ~PagedPoolAllocator
-					Destructs the current instance releasing all the associated memory
-			*/
-			~PagedPoolAllocator();
-
-			/*
-				Function: allocate
-					Allocates a new instance  *without* calling the constructor, it has to be manually
-					placed new
-			*/
-			template <typename ...CtorArgs>
-			Type* allocate(CtorArgs&&... ctor_args);
-
-			/*
-				Function: deallocate
-					Deallocates a previously allocated pointer. Memory is not freed, but will be reused
-			*/
-			void deallocate(Type* ptr);
-
-		private:
-			u32 m_alignment;
-
-			TypedReusablePage<Type, count>* m_current_page;
-			TypedReusablePage<Type, count>* m_first;
-		};
-	}
-}
-
+#pragma once
+
+#include "page.hpp"
+
+namespace camy
+{
+	namespace allocators
+	{
+		namespace hidden
+		{
+			// Smallest power of two >= size, C++11 constexpr because of VS2015
+			constexpr Size pool_page_alignment(Size size, Size alignment = 1)
+			{
+				return alignment >= size ? alignment : pool_page_alignment(size, alignment << 1);
+			}
+		}
+
+		template <typename Type, u32 count>
+		struct TypedReusablePage : public Page<sizeof(Type) * count>
+		{
+			static_assert(count > 0, "Can't created a page with size 0");
+			static_assert(sizeof(Type) >= sizeof(u32), "Typed pages element size has to be > 32 bit");
+
+			union StoredType
+			{
+				~StoredType() { data.~Type(); }
+				Type data;
+				u32  next_free;
+			};
+
+			static_assert(sizeof(StoredType) == sizeof(Type), "Segmentation faults will occur if this condition is not verified");
+
+			TypedReusablePage();
+
+			template <typename ...CtorArgs>
+			Type* allocate(CtorArgs&&... ctor_args);
+
+			void deallocate(Type* ptr);
+
+			bool is_full()const { return m_free_count == 0; }
+			bool is_empty()const { return m_free_count == count; }
+
+			u32 m_next_free{ 0 };
+			u32 m_free_count{ count };
+
+			// Links in the list of pages with at least one free slot
+			TypedReusablePage<Type, count>* m_next_available{ nullptr };
+			TypedReusablePage<Type, count>* m_previous_available{ nullptr };
+		};
+
+		/*
+			Class: PagedPoolAllocator
+				Typed pool allocator that allows to reuse pointers ( it is not index-based ), it uses
+				reusable pages. 
+				
+				Type is the type of the pool ( since it's tpe
+
+				Pages are aligned to their size ( rounded up to a power of two ), the page a pointer belongs to
+				is found by masking the pointer. Pages with at least one free slot are kept in their own list,
+				thus both allocate() and deallocate() are O(1) regardless of the number of pages. Pages that 
+				become empty are released as soon as more than max_empty_pages are empty, keeping a few around
+				avoids allocating and releasing a page when an object is repeatedly created and destroyed
+		*/
+		template <typename Type, u32 count = 10>
+		class PagedPoolAllocator final
+		{
+			static_assert(count > 0, "Can't created a pool allocator with page size 0");
+		public:
+			/*
+				Constructor: PagedPoolAllocator
+					Constructs a new instance preallocating one page
+			*/
+			PagedPoolAllocator(u32 max_empty_pages = 1);
+
+			/*
+				Destuctor: ~PagedPoolAllocator
+					Destructs the current instance releasing all the associated memory
+			*/
+			~PagedPoolAllocator();
+
+			PagedPoolAllocator(const PagedPoolAllocator& other) = delete;
+			PagedPoolAllocator& operator=(const PagedPoolAllocator& other) = delete;
+
+			/*
+				Function: allocate
+					Allocates a new instance forwarding the arguments to the constructor
+			*/
+			template <typename ...CtorArgs>
+			Type* allocate(CtorArgs&&... ctor_args);
+
+			/*
+				Function: deallocate
+					Deallocates a previously allocated pointer calling the destructor. ptr has to be
+					allocated by this very allocator, nullptr is ignored
+			*/
+			void deallocate(Type* ptr);
+
+			/*
+				Function: set_max_empty_pages
+					Number of empty pages kept around instead of being released, 0 releases them immediately.
+					Pages already empty are not released until something is deallocated from them
+			*/
+			void set_max_empty_pages(u32 max_empty_pages) { m_max_empty_pages = max_empty_pages; }
+
+			u32 get_num_pages()const { return m_num_pages; }
+			u32 get_num_empty_pages()const { return m_num_empty_pages; }
+
+		private:
+			using PageType = TypedReusablePage<Type, count>;
+
+			static const Size page_alignment{ hidden::pool_page_alignment(sizeof(PageType)) };
+
+			PageType* _allocate_page();
+			void	  _release_page(PageType* page);
+			void	  _push_available(PageType* page);
+			void	  _remove_available(PageType* page);
+
+		private:
+			u32 m_max_empty_pages;
+			u32 m_num_empty_pages;
+			u32 m_num_pages;
+
+			// All the pages, linked through Page::next / previous
+			PageType* m_first;
+
+			// Pages with at least one free slot
+			PageType* m_available;
+		};
+	}
+}
+
 #include "paged_pool_allocator.inl"
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+// camy
+#include "../base.hpp"
+#include "../com_utils.hpp"
+#include "virtual_linear_allocator.hpp"
+
+namespace camy
+{
+	namespace allocators
+	{
+		/*
+			Class: ReservedVector
+				Contiguous array backed by a VirtualLinearAllocator, address space for max_size elements is
+				reserved the first time an element is added and committed as it grows. Unlike std::vector it never
+				reallocates: growing doesn't copy the elements and pointers stay valid until they are removed.
+				clear() is O(1) for trivially destructible types and keeps the committed memory.
+				Going over max_size is an error, the push fails and nullptr is returned
+		*/
+		template <typename Type>
+		class ReservedVector final
+		{
+		public:
+			ReservedVector(u32 max_size);
+			~ReservedVector();
+
+			ReservedVector(const ReservedVector& other);
+			ReservedVector& operator=(const ReservedVector& other);
+
+			/*
+				Function: emplace_back
+					Constructs a new element at the end, nullptr if max_size has been reached
+			*/
+			template <typename ...CtorArgs>
+			Type* emplace_back(CtorArgs&&... ctor_args);
+			Type* push_back(const Type& value) { return emplace_back(value); }
+
+			/*
+				Function: append
+					Copies count elements at the end, false if they don't fit
+			*/
+			bool append(const Type* values, u32 count);
+
+			/*
+				Function: reserve
+					Commits memory for size elements in advance, it never moves the elements
+			*/
+			bool reserve(u32 size);
+
+			void clear();
+			void swap(ReservedVector& other);
+
+			/*
+				Function: set_max_size
+					Changes the size of the range, the address space is given back and reserved again by the
+					next push. Only empty vectors can be resized, false otherwise
+			*/
+			bool set_max_size(u32 max_size);
+
+			Type& operator[](u32 index) { return m_data[index]; }
+			const Type& operator[](u32 index)const { return m_data[index]; }
+
+			Type& front() { return m_data[0]; }
+			const Type& front()const { return m_data[0]; }
+			Type& back() { return m_data[m_size - 1]; }
+			const Type& back()const { return m_data[m_size - 1]; }
+
+			Type* data() { return m_data; }
+			const Type* data()const { return m_data; }
+
+			Type* begin() { return m_data; }
+			Type* end() { return m_data + m_size; }
+			const Type* begin()const { return m_data; }
+			const Type* end()const { return m_data + m_size; }
+
+			u32 size()const { return m_size; }
+			u32 max_size()const { return m_max_size; }
+			bool empty()const { return m_size == 0; }
+
+		private:
+			Type* _grow(u32 count);
+
+		private:
+			VirtualLinearAllocator* m_allocator;
+			Type* m_data;
+			u32	  m_size;
+			u32	  m_max_size;
+		};
+	}
+}
+
+#include "reserved_vector.inl"
@@ -0,0 +1,163 @@
+// C++ STL
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace camy
+{
+	namespace allocators
+	{
+		template <typename Type>
+		ReservedVector<Type>::ReservedVector(u32 max_size) :
+			m_allocator{ nullptr },
+			m_data{ nullptr },
+			m_size{ 0 },
+			m_max_size{ max_size }
+		{
+
+		}
+
+		template <typename Type>
+		ReservedVector<Type>::~ReservedVector()
+		{
+			clear();
+			safe_release(m_allocator);
+		}
+
+		template <typename Type>
+		ReservedVector<Type>::ReservedVector(const ReservedVector& other) :
+			ReservedVector(other.m_max_size)
+		{
+			append(other.m_data, other.m_size);
+		}
+
+		template <typename Type>
+		ReservedVector<Type>& ReservedVector<Type>::operator=(const ReservedVector& other)
+		{
+			if (this != &other)
+			{
+				clear();
+
+				// Current range is kept if big enough
+				if (m_allocator != nullptr && m_max_size < other.m_max_size)
+				{
+					safe_release(m_allocator);
+					m_data = nullptr;
+				}
+
+				if (m_allocator == nullptr)
+					m_max_size = other.m_max_size;
+
+				append(other.m_data, other.m_size);
+			}
+			return *this;
+		}
+
+		template <typename Type>
+		template <typename ...CtorArgs>
+		Type* ReservedVector<Type>::emplace_back(CtorArgs&&... ctor_args)
+		{
+			auto memory{ _grow(1) };
+			if (memory == nullptr)
+				return nullptr;
+
+			return new (memory) Type(std::forward<CtorArgs>(ctor_args)...);
+		}
+
+		template <typename Type>
+		bool ReservedVector<Type>::append(const Type* values, u32 count)
+		{
+			if (count == 0)
+				return true;
+
+			auto memory{ _grow(count) };
+			if (memory == nullptr)
+				return false;
+
+			for (auto i{ 0u }; i < count; ++i)
+				new (memory + i) Type(values[i]);
+			return true;
+		}
+
+		template <typename Type>
+		bool ReservedVector<Type>::reserve(u32 size)
+		{
+			if (size <= m_size)
+				return true;
+
+			// Committing by allocating and giving back, the elements are not touched
+			const auto current_size{ m_size };
+			if (_grow(size - current_size) == nullptr)
+				return false;
+
+			m_size = current_size;
+			m_allocator->rewind(sizeof(Type) * m_size);
+			return true;
+		}
+
+		template <typename Type>
+		void ReservedVector<Type>::clear()
+		{
+			if (!std::is_trivially_destructible<Type>::value)
+			{
+				for (auto i{ 0u }; i < m_size; ++i)
+					m_data[i].~Type();
+			}
+
+			m_size = 0;
+			if (m_allocator != nullptr)
+				m_allocator->reset();
+		}
+
+		template <typename Type>
+		bool ReservedVector<Type>::set_max_size(u32 max_size)
+		{
+			if (m_size > 0)
+				return false;
+
+			safe_release(m_allocator);
+			m_data = nullptr;
+			m_max_size = max_size;
+			return true;
+		}
+
+		template <typename Type>
+		void ReservedVector<Type>::swap(ReservedVector& other)
+		{
+			std::swap(m_allocator, other.m_allocator);
+			std::swap(m_data, other.m_data);
+			std::swap(m_size, other.m_size);
+			std::swap(m_max_size, other.m_max_size);
+		}
+
+		template <typename Type>
+		Type* ReservedVector<Type>::_grow(u32 count)
+		{
+			if (m_size + count > m_max_size || m_size + count < m_size)
+			{
+				camy_error("ReservedVector is full, max size: ", m_max_size, " requested: ", m_size + count);
+				return nullptr;
+			}
+
+			// Address space is reserved only when it's actually needed
+			if (m_allocator == nullptr)
+			{
+				m_allocator = new VirtualLinearAllocator();
+				if (!m_allocator->reserve(static_cast<Size>(m_max_size) * sizeof(Type)))
+				{
+					safe_release(m_allocator);
+					return nullptr;
+				}
+				m_data = reinterpret_cast<Type*>(m_allocator->get_base());
+			}
+
+			// Elements are tightly packed, base is page aligned and every allocation is a multiple of sizeof(Type)
+			auto memory{ static_cast<Type*>(m_allocator->allocate(sizeof(Type) * count, 1)) };
+			if (memory == nullptr)
+				return nullptr;
+
+			m_size += count;
+			return memory;
+		}
+	}
+}
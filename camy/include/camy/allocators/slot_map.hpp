@@ -0,0 +1,127 @@
+#pragma once
+
+// camy
+#include "../base.hpp"
+
+// C++ STL
+#include <utility>
+#include <vector>
+
+namespace camy
+{
+	/*
+		Struct: SlotHandle
+			Reference to an element of a SlotMap. index identifies the slot, generation is incremented every time
+			the element in the slot is removed, handles to removed elements are detected by comparing generations.
+			Default constructed handles are invalid ( generation 0 is never used )
+	*/
+	struct SlotHandle
+	{
+		u32 index{ ~0u };
+		u32 generation{ 0 };
+
+		bool is_valid()const { return generation != 0; }
+
+		// Generation and index packed together, unique for the lifetime of the map ( e.g. as hash key )
+		u64 get_key()const { return static_cast<u64>(generation) << 32 | index; }
+
+		bool operator==(const SlotHandle& other)const { return index == other.index && generation == other.generation; }
+		bool operator!=(const SlotHandle& other)const { return !(*this == other); }
+	};
+
+	namespace allocators
+	{
+		/*
+			Class: SlotMap
+				Container whose elements are referenced by generational handles instead of pointers. Elements are
+				stored densely ( no holes ) thus iterating is a linear walk over contiguous memory, removing swaps the
+				last element into the hole. Handle -> element goes through the slots array, element -> handle through
+				the dense slot array, both are O(1) and so are insertion and removal.
+				Elements move when others are removed or the storage grows, pointers are valid only until the next
+				insert / remove, handles are to be stored instead.
+		*/
+		template <typename Type>
+		class SlotMap final
+		{
+		public:
+			using Handle = SlotHandle;
+
+			SlotMap(u32 capacity_estimate = 0);
+			~SlotMap() = default;
+
+			/*
+				Function: insert
+					Adds a new element, the returned handle stays valid until remove()
+			*/
+			Handle insert(const Type& value);
+			Handle insert(Type&& value);
+
+			template <typename ...CtorArgs>
+			Handle emplace(CtorArgs&&... ctor_args);
+
+			/*
+				Function: remove
+					Removes the element referenced by handle, false if the handle was stale or invalid
+			*/
+			bool remove(Handle handle);
+
+			/*
+				Function: get
+					Returns the element referenced by handle or nullptr if it has been removed
+			*/
+			Type* get(Handle handle);
+			const Type* get(Handle handle)const;
+
+			bool contains(Handle handle)const;
+
+			/*
+				Function: get_handle
+					Handle of the element at dense_index ( 0 <= dense_index < size() )
+			*/
+			Handle get_handle(u32 dense_index)const;
+
+			void clear();
+			void reserve(u32 capacity);
+
+			/*
+				Function: data
+					Elements in dense order, the order is not the insertion order
+			*/
+			Type* data() { return m_values.data(); }
+			const Type* data()const { return m_values.data(); }
+			u32 size()const { return static_cast<u32>(m_values.size()); }
+			bool empty()const { return m_values.empty(); }
+
+			Type* begin() { return m_values.data(); }
+			Type* end() { return m_values.data() + m_values.size(); }
+			const Type* begin()const { return m_values.data(); }
+			const Type* end()const { return m_values.data() + m_values.size(); }
+
+		private:
+			Handle _acquire_slot();
+
+			/*
+				Struct: Slot
+					dense_index is the position in the dense arrays for alive slots and the next
+					free slot for free ones
+			*/
+			struct Slot
+			{
+				u32 dense_index;
+				u32 generation;
+			};
+
+			static const u32 invalid_index{ ~0u };
+
+		private:
+			// Dense arrays ( structure of arrays ), m_dense_slots[i] is the slot of m_values[i]
+			std::vector<Type> m_values;
+			std::vector<u32>  m_dense_slots;
+
+			std::vector<Slot> m_slots;
+			u32				  m_free_head;
+		};
+	}
+}
+
+#include "slot_map.inl"
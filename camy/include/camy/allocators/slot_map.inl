@@ -0,0 +1,139 @@
+namespace camy
+{
+	namespace allocators
+	{
+		template <typename Type>
+		SlotMap<Type>::SlotMap(u32 capacity_estimate) :
+			m_free_head{ invalid_index }
+		{
+			reserve(capacity_estimate);
+		}
+
+		template <typename Type>
+		SlotHandle SlotMap<Type>::insert(const Type& value)
+		{
+			auto handle{ _acquire_slot() };
+			m_values.push_back(value);
+			return handle;
+		}
+
+		template <typename Type>
+		SlotHandle SlotMap<Type>::insert(Type&& value)
+		{
+			auto handle{ _acquire_slot() };
+			m_values.push_back(std::move(value));
+			return handle;
+		}
+
+		template <typename Type>
+		template <typename ...CtorArgs>
+		SlotHandle SlotMap<Type>::emplace(CtorArgs&&... ctor_args)
+		{
+			auto handle{ _acquire_slot() };
+			m_values.emplace_back(std::forward<CtorArgs>(ctor_args)...);
+			return handle;
+		}
+
+		template <typename Type>
+		bool SlotMap<Type>::remove(Handle handle)
+		{
+			if (!contains(handle))
+				return false;
+
+			auto& slot{ m_slots[handle.index] };
+			const auto dense_index{ slot.dense_index };
+			const auto last_index{ size() - 1 };
+
+			// Filling the hole with the last element
+			if (dense_index != last_index)
+			{
+				m_values[dense_index] = std::move(m_values[last_index]);
+				m_dense_slots[dense_index] = m_dense_slots[last_index];
+				m_slots[m_dense_slots[dense_index]].dense_index = dense_index;
+			}
+
+			m_values.pop_back();
+			m_dense_slots.pop_back();
+
+			// Generation 0 is reserved for invalid handles
+			if (++slot.generation == 0)
+				slot.generation = 1;
+
+			slot.dense_index = m_free_head;
+			m_free_head = handle.index;
+
+			return true;
+		}
+
+		template <typename Type>
+		Type* SlotMap<Type>::get(Handle handle)
+		{
+			return contains(handle) ? &m_values[m_slots[handle.index].dense_index] : nullptr;
+		}
+
+		template <typename Type>
+		const Type* SlotMap<Type>::get(Handle handle)const
+		{
+			return contains(handle) ? &m_values[m_slots[handle.index].dense_index] : nullptr;
+		}
+
+		template <typename Type>
+		bool SlotMap<Type>::contains(Handle handle)const
+		{
+			// Free slots have already a different generation
+			return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation;
+		}
+
+		template <typename Type>
+		SlotHandle SlotMap<Type>::get_handle(u32 dense_index)const
+		{
+			camy_assert(dense_index < size(), { return Handle(); }, "Dense index out of range: ", dense_index);
+
+			Handle handle;
+			handle.index = m_dense_slots[dense_index];
+			handle.generation = m_slots[handle.index].generation;
+			return handle;
+		}
+
+		template <typename Type>
+		void SlotMap<Type>::clear()
+		{
+			// Handles are invalidated through the generations, slots are not released
+			while (!m_values.empty())
+				remove(get_handle(size() - 1));
+		}
+
+		template <typename Type>
+		void SlotMap<Type>::reserve(u32 capacity)
+		{
+			m_values.reserve(capacity);
+			m_dense_slots.reserve(capacity);
+			m_slots.reserve(capacity);
+		}
+
+		template <typename Type>
+		SlotHandle SlotMap<Type>::_acquire_slot()
+		{
+			Handle handle;
+
+			if (m_free_head != invalid_index)
+			{
+				handle.index = m_free_head;
+				m_free_head = m_slots[handle.index].dense_index;
+			}
+			else
+			{
+				handle.index = static_cast<u32>(m_slots.size());
+				m_slots.push_back({ 0, 1 });
+			}
+
+			auto& slot{ m_slots[handle.index] };
+			slot.dense_index = size();
+			handle.generation = slot.generation;
+
+			m_dense_slots.push_back(handle.index);
+
+			return handle;
+		}
+	}
+}
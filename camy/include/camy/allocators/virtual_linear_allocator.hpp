@@ -0,0 +1,130 @@
+#pragma once
+
+// camy
+#include "../base.hpp"
+
+namespace camy
+{
+	namespace allocators
+	{
+		/*
+			Class: VirtualLinearAllocator
+				Linear allocator over a single contiguous range of address space. The whole range is reserved
+				once ( no memory is used ) and committed in commit_block_size steps as the offset grows, thus
+				memory is contiguous, pointers are never invalidated and there is no limit on the size of a
+				single allocation other than the reserved size. Resetting is O(1), committed memory is kept
+				for the next round and can be given back with decommit().
+				Not thread safe, use one per thread.
+
+				If large pages are requested ( and the process has the SeLockMemoryPrivilege ) the whole range
+				is committed upfront with MEM_LARGE_PAGES, windows doesn't allow committing large pages on demand.
+				If it fails it falls back to regular pages, see is_using_large_pages()
+		*/
+		class VirtualLinearAllocator final
+		{
+		public:
+			static const Size commit_block_size{ 1024 * 64 };
+
+			/*
+				Constructor: VirtualLinearAllocator
+					Does not reserve anything, reserve() has to be called before allocating
+			*/
+			VirtualLinearAllocator();
+
+			/*
+				Constructor: VirtualLinearAllocator
+					Reserves reserve_size bytes, see reserve()
+			*/
+			VirtualLinearAllocator(Size reserve_size, bool use_large_pages = false);
+
+			/*
+				Destructor: ~VirtualLinearAllocator
+					Releases the reserved range, all the pointers are invalidated
+			*/
+			~VirtualLinearAllocator();
+
+			VirtualLinearAllocator(const VirtualLinearAllocator& other) = delete;
+			VirtualLinearAllocator& operator=(const VirtualLinearAllocator& other) = delete;
+
+			/*
+				Function: reserve
+					Reserves the address range, previous memory is released. reserve_size is rounded up
+					to commit_block_size ( or to the large page size )
+			*/
+			bool reserve(Size reserve_size, bool use_large_pages = false);
+
+			/*
+				Function: release
+					Gives back the whole range, reserve() has to be called again before allocating
+			*/
+			void release();
+
+			/*
+				Function: allocate
+					Allocates size bytes aligned to alignment ( power of two ), nullptr if the reserved range is exhausted
+			*/
+			void* allocate(Size size, Size alignment = 16);
+
+			/*
+				Function: reset
+					Invalidates all the previous allocations in O(1), committed memory is not touched
+			*/
+			void reset() { rewind(0); }
+
+			/*
+				Function: rewind
+					Moves the offset back to allocated_size ( <= get_allocated_size() ), memory after it can be
+					allocated again. Used to pop allocations in LIFO order
+			*/
+			void rewind(Size allocated_size);
+
+			/*
+				Function: decommit
+					Returns to the OS the committed memory after the current offset. Large pages can't be decommitted
+			*/
+			void decommit();
+
+			/*
+				Function: get_base
+					Start of the range, allocations are all contiguous starting from here
+			*/
+			Byte* get_base() { return m_base; }
+			const Byte* get_base()const { return m_base; }
+
+			Size get_allocated_size()const { return m_offset; }
+			Size get_committed_size()const { return m_committed_size; }
+			Size get_reserved_size()const { return m_reserved_size; }
+			Size get_high_water_mark()const { return m_offset > m_high_water_mark ? m_offset : m_high_water_mark; }
+
+			bool is_reserved()const { return m_base != nullptr; }
+			bool is_using_large_pages()const { return m_large_pages; }
+
+		private:
+			bool _commit(Size size);
+
+		private:
+			Byte* m_base;
+			Size  m_offset;
+			Size  m_committed_size;
+			Size  m_reserved_size;
+			Size  m_high_water_mark;
+			bool  m_large_pages;
+		};
+
+		camy_inline void* VirtualLinearAllocator::allocate(Size size, Size alignment)
+		{
+			camy_assert(alignment != 0 && (alignment & (alignment - 1)) == 0, { return nullptr; }, "Alignment has to be a power of two: ", alignment);
+
+			// Base is page aligned, aligning the offset is the same as aligning the address
+			const auto start{ (m_offset + alignment - 1) & ~(alignment - 1) };
+			const auto end{ start + size };
+
+			// Slow path, committing ( or out of memory )
+			if (end > m_committed_size && !_commit(end))
+				return nullptr;
+
+			m_offset = end;
+			return m_base + start;
+		}
+	}
+}
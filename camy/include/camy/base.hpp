@@ -61,6 +61,11 @@ No additional linking directories should be added when opening this project in v
 
 #define camy_inline __forceinline
 
+/*
+	Data written by different threads is kept at least this far apart to avoid false sharing
+*/
+#define camy_cache_line_size 64
+
 /*
 	Topic: Common non-mathematical types
 */
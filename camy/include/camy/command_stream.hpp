@@ -0,0 +1,370 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "common_structs.hpp"
+#include "resources.hpp"
+#include "shader.hpp"
+#include "hazard_tracker.hpp"
+
+// C++ STL
+#include <vector>
+
+namespace camy
+{
+	// Forward declarations
+	class PipelineState;
+	class RenderLayer;
+	class ComputeLayer;
+	class PostProcessLayer;
+
+	/*
+		Topic: Command streams
+			Layers are not interpreted directly by the backend, they are first compiled into a CommandStream:
+			a linear buffer of compact commands ( binds, constant uploads, draws, dispatches ) where redundant
+			binds have already been stripped and instance data has already been gathered. Constant data of all the
+			uploads is packed in a separate block, laid out as it will be in the backend upload ring: the backend
+			copies it with a single map per stream and binds the uploads by offset. Compiling doesn't
+			touch the device and only reads the layer, thus different layers can be compiled in parallel
+			( see LayerDispatcher ) and the streams can be inspected without a device.
+			GPUBackend::execute(const CommandStream&) replays the commands in order.
+			Every stream assumes nothing about the state the previous one left, the first binds are never stripped.
+			A stream is a snapshot of the layer: common states, constants and instance data are copied, thus
+			the layer can be recorded again right after compiling ( see LayerDispatcher::set_pipelined ). Only
+			the resources ( buffers, surfaces, shaders, states ) are referenced and have to stay alive until
+			the stream has been executed
+	*/
+	enum class CommandType : u16
+	{
+		SetCommonStates,
+		SetVertexBuffer,
+		SetIndexBuffer,
+		SetPrimitiveTopology,
+		SetShader,
+		SetInstanceStream,		// Binds the backend instance stream with the specified stride
+		BindRange,				// Samplers, surfaces and buffers bound to consecutive slots, followed by the parameters
+		UploadConstants,		// Constant buffers, data is in the stream constant block
+		Unbind,
+		UnbindOutputs,			// Render targets and depth buffer, common states are reset to the defaults
+		ClearSurface,
+		UpdateBuffer,			// Followed by the data
+		Draw,
+		DrawInstanced,			// Followed by the instance data
+		Dispatch,
+		PostProcess,
+		LastValue
+	};
+
+	/*
+		Struct: Command
+			Header shared by all the commands, size includes the header and the trailing data ( if any )
+			and is always a multiple of command_alignment
+	*/
+	struct Command
+	{
+		static const u32 command_alignment{ 8 };
+
+		CommandType type;
+		u16			padding;
+		u32			size;
+	};
+
+	struct SetCommonStatesCommand : Command
+	{
+		static const CommandType command_type{ CommandType::SetCommonStates };
+		CommonStates common_states;
+		u32			 use_defaults;	// Items with no common states
+		u32			 changed_parts; // CommonStatesParts to set, the others are the same as the bound ones
+	};
+
+	struct SetVertexBufferCommand : Command
+	{
+		static const CommandType command_type{ CommandType::SetVertexBuffer };
+		const VertexBuffer* vertex_buffer;
+		u32 slot;
+	};
+
+	struct SetIndexBufferCommand : Command
+	{
+		static const CommandType command_type{ CommandType::SetIndexBuffer };
+		const IndexBuffer* index_buffer;
+	};
+
+	struct SetPrimitiveTopologyCommand : Command
+	{
+		static const CommandType command_type{ CommandType::SetPrimitiveTopology };
+		PrimitiveTopology primitive_topology;
+	};
+
+	struct SetShaderCommand : Command
+	{
+		static const CommandType command_type{ CommandType::SetShader };
+		const Shader* shader;
+		Shader::Type  shader_type;
+	};
+
+	struct SetInstanceStreamCommand : Command
+	{
+		static const CommandType command_type{ CommandType::SetInstanceStream };
+		u32 stride;
+	};
+
+	/*
+		Enum: BindRangeType
+			Slot spaces a range can span, surfaces and buffers share the shader resource ( and UAV ) slots.
+			UAVs are compute only, other stages bind their shader resource view
+	*/
+	enum class BindRangeType : u16
+	{
+		Sampler,
+		ShaderResource,
+		UnorderedAccess
+	};
+
+	struct BindRangeCommand : Command
+	{
+		static const CommandType command_type{ CommandType::BindRange };
+		Shader::Type  shader_type;
+		BindRangeType range_type;
+		u16			  first_slot;
+		u32			  num_parameters;
+		u32			  padding; // Keeps the parameters aligned
+
+		// num_parameters parameters follow, slots are first_slot, first_slot + 1, ...
+		const PipelineParameter* get_parameters()const { return reinterpret_cast<const PipelineParameter*>(this + 1); }
+	};
+
+	struct UploadConstantsCommand : Command
+	{
+		static const CommandType command_type{ CommandType::UploadConstants };
+		ShaderVariable shader_variable;
+
+		// Of the data in CommandStream::get_constant_data(), multiple of features::constant_data_alignment
+		// as is the space reserved ( shader_variable.size rounded up )
+		u32 offset;
+	};
+
+	struct UnbindCommand : Command
+	{
+		static const CommandType command_type{ CommandType::Unbind };
+		Dependency dependency;
+	};
+
+	struct UnbindOutputsCommand : Command
+	{
+		static const CommandType command_type{ CommandType::UnbindOutputs };
+	};
+
+	struct ClearSurfaceCommand : Command
+	{
+		static const CommandType command_type{ CommandType::ClearSurface };
+		const Surface* surface;
+		float color[4];
+		float depth;
+		u32	  stencil;
+		u32	  has_color;
+	};
+
+	struct UpdateBufferCommand : Command
+	{
+		static const CommandType command_type{ CommandType::UpdateBuffer };
+		const Buffer* buffer;
+		u32 data_size;
+
+		// data_size bytes follow
+		const Byte* get_data()const { return reinterpret_cast<const Byte*>(this + 1); }
+	};
+
+	struct DrawCommand : Command
+	{
+		static const CommandType command_type{ CommandType::Draw };
+		DrawInfo draw_info;
+	};
+
+	struct DrawInstancedCommand : Command
+	{
+		static const CommandType command_type{ CommandType::DrawInstanced };
+		DrawInfo draw_info;
+		u32		 num_instances;
+		u32		 instance_data_size;
+
+		// num_instances * instance_data_size bytes follow
+		const Byte* get_instance_data()const { return reinterpret_cast<const Byte*>(this + 1); }
+	};
+
+	struct DispatchCommand : Command
+	{
+		static const CommandType command_type{ CommandType::Dispatch };
+		u32 group_countx;
+		u32 group_county;
+		u32 group_countz;
+	};
+
+	struct PostProcessCommand : Command
+	{
+		static const CommandType command_type{ CommandType::PostProcess };
+		const Shader*	  pixel_shader;
+		const Surface*	  input_surface; // Already resolved, might be the output of the previous item
+		const Surface*	  output_surface;
+		const BlendState* blend_state;
+	};
+
+	/*
+		Class: CommandStream
+			See Topic: Command streams. Memory is kept across compilations, after a few frames
+			compiling doesn't allocate
+	*/
+	class CommandStream final
+	{
+	public:
+		/*
+			Struct: Stats
+				Counters of the last compilation, binds are all the set / bind commands emitted,
+				redundant_binds the ones that have been stripped because the state was already set. A bind range
+				is a single bind, bound_parameters is the number of slots the ranges cover.
+				constant_data_size is upload_size plus the alignment padding
+		*/
+		struct Stats
+		{
+			u32 num_commands{ 0 };
+			u32 num_binds{ 0 };
+			u32 num_redundant_binds{ 0 };
+			u32 num_bound_parameters{ 0 };
+			u32 num_uploads{ 0 };
+			u32 upload_size{ 0 };
+			u32 constant_data_size{ 0 };
+			u32 num_draws{ 0 };
+			u32 num_instances{ 0 };
+			u32 num_dispatches{ 0 };
+		};
+
+		CommandStream() = default;
+		~CommandStream() = default;
+
+		/*
+			Function: compile
+				Clears the stream and translates the layer, the layer has to be Ready ( or Permanent )
+		*/
+		void compile(const RenderLayer& render_layer);
+		void compile(const ComputeLayer& compute_layer);
+		void compile(const PostProcessLayer& pp_layer);
+
+		/*
+			Function: compile
+				Appends a single compute item, used by GPUBackend::execute(const ComputeItem&)
+		*/
+		void compile(const ComputeItem& compute_item);
+
+		/*
+			Function: clear_surface
+				Appends a clear, same parameters as GPUBackend::clear_surface
+		*/
+		void clear_surface(const Surface* surface, const float* color, const float depth, const u32 stencil);
+
+		/*
+			Function: update
+				Appends a buffer update, the whole buffer is copied into the stream
+		*/
+		void update(const Buffer* buffer, const void* data);
+
+		/*
+			Function: unbind
+				Appends an unbind, only surfaces and buffers are unbound ( see GPUBackend::unbind )
+		*/
+		void unbind(const Dependency& dependency);
+		void unbind_outputs();
+
+		void clear();
+		void swap(CommandStream& other);
+
+		/*
+			Function: push
+				Appends a command of type CommandStruct, extra_size bytes are reserved after it. The pointer is
+				valid until the next push
+		*/
+		template <typename CommandStruct>
+		CommandStruct* push(u32 extra_size = 0);
+
+		/*
+			Function: get_first
+				First command of the stream, nullptr if empty. Iterate with get_next()
+		*/
+		const Command* get_first()const { return m_data.empty() ? nullptr : reinterpret_cast<const Command*>(&m_data[0]); }
+		const Command* get_next(const Command* command)const;
+
+		const Byte* get_data()const { return m_data.empty() ? nullptr : reinterpret_cast<const Byte*>(&m_data[0]); }
+		Size get_size()const { return m_data.size() * sizeof(u64); }
+		bool empty()const { return m_data.empty(); }
+
+		/*
+			Function: get_constant_data
+				Data of all the UploadConstants commands, get_constant_data_size() bytes. Copied as is
+				to a features::constant_data_alignment aligned offset, the commands' offsets stay valid
+		*/
+		const Byte* get_constant_data()const { return m_constant_data.empty() ? nullptr : &m_constant_data[0]; }
+		u32 get_constant_data_size()const { return static_cast<u32>(m_constant_data.size()); }
+
+		const Stats& get_stats()const { return m_stats; }
+
+	private:
+		// _set_* skip the bind if redundant, _push_* always emit it
+		void _set_pipeline_state(const PipelineState& pipeline_state);
+		void _set_common_states(const CommonStates* common_states);
+		void _set_vertex_buffer(u32 slot, const VertexBuffer* vertex_buffer);
+		void _set_index_buffer(const IndexBuffer* index_buffer);
+		void _set_primitive_topology(PrimitiveTopology primitive_topology);
+		void _set_shader(Shader::Type shader_type, const Shader* shader);
+		void _push_common_states(const CommonStates* common_states, u32 changed_parts);
+		void _push_primitive_topology(PrimitiveTopology primitive_topology);
+		void _push_shader(Shader::Type shader_type, const Shader* shader);
+		void _bind_parameters(const ParameterGroup& parameters);
+		void _push_bind_ranges();
+
+		/*
+			Struct: BindCache
+				What has been bound so far in this stream, used to strip redundant binds
+		*/
+		struct BindCache
+		{
+			// Set if the states have last been set by this pipeline state, cleared by any other change
+			const PipelineState* pipeline_state;
+
+			const CommonStates* common_states;
+			const VertexBuffer* vertex_buffers[2];
+			const IndexBuffer*  index_buffer;
+			PrimitiveTopology	primitive_topology;
+			const Shader*		shaders[Shader::num_types];
+			u32					states_set;
+
+			const ParameterGroup* parameter_groups[features::num_cache_slots];
+
+			const void* samplers[Shader::num_types][features::max_bindable_samplers];
+			const void* resources[Shader::num_types][features::max_bindable_shader_resources];
+			const void* uavs[Shader::num_types][features::max_bindable_shader_resources];
+			const void* constants[Shader::num_types][features::max_bindable_constant_buffers];
+
+			// One past the highest resource / uav slot set
+			u32 resources_end[Shader::num_types];
+			u32 uavs_end[Shader::num_types];
+		};
+
+		// The backend unbinds the views conflicting with a bind ( see HazardTracker ), the cache forgets them too
+		// otherwise the next bind of the same resource would be stripped
+		void _forget_hazards(const void* resource, HazardTracker::Usage usage);
+
+		void _reset_cache();
+		const void** _cached_binding(const ShaderVariable& variable);
+
+	private:
+		// u64 storage keeps the commands aligned
+		std::vector<u64> m_data;
+		std::vector<Byte> m_constant_data;
+		Stats m_stats;
+
+		// Binds of the group being translated, coalesced into ranges by _push_bind_ranges()
+		std::vector<PipelineParameter> m_pending_binds;
+		BindCache m_cache;
+	};
+}
+
+#include "command_stream.inl"
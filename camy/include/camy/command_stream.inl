@@ -0,0 +1,35 @@
+// C++ STL
+#include <new>
+#include <type_traits>
+
+namespace camy
+{
+	template <typename CommandStruct>
+	CommandStruct* CommandStream::push(u32 extra_size)
+	{
+		static_assert(std::is_base_of<Command, CommandStruct>::value, "Commands have to derive from Command");
+		static_assert(alignof(CommandStruct) <= Command::command_alignment, "Command alignment is too big");
+
+		const u32 size{ (static_cast<u32>(sizeof(CommandStruct)) + extra_size + Command::command_alignment - 1) / Command::command_alignment * Command::command_alignment };
+
+		const auto offset{ m_data.size() };
+		m_data.resize(offset + size / sizeof(u64));
+
+		auto command{ new (&m_data[offset]) CommandStruct() };
+		command->type = CommandStruct::command_type;
+		command->padding = 0;
+		command->size = size;
+
+		++m_stats.num_commands;
+		return command;
+	}
+
+	inline const Command* CommandStream::get_next(const Command* command)const
+	{
+		auto next{ reinterpret_cast<const Byte*>(command) + command->size };
+		if (next >= get_data() + get_size())
+			return nullptr;
+
+		return reinterpret_cast<const Command*>(next);
+	}
+}
@@ -10,6 +10,7 @@ using GraphicsAPIVersion = camy::u32;
 
 struct ID3D11Device;
 struct ID3D11DeviceContext;
+struct ID3D11DeviceContext1;
 
 struct ID3D11Buffer;
 struct ID3D11Texture2D;
@@ -0,0 +1,85 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "features.hpp"
+
+// C++ STL
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace camy
+{
+	/*
+		Class: DestructionQueue
+			Resources disposed while still possibly referenced by in-flight work, filled by GPUBackend::dispose.
+			Every resource is tagged with the frame it was pushed in and released delay frames later by
+			begin_frame(), in batches and in push order. Disposing a resource means it's not going to be used
+			by the frames recorded from then on, thus the push frame is its last use.
+			Pushing is thread safe, begin_frame() and flush() are meant to be called by the thread replaying the
+			frames, releases are called on it outside the lock.
+	*/
+	class DestructionQueue final
+	{
+	public:
+		// Releases the resource, backend specific
+		using Release = std::function<void()>;
+
+		/*
+			Struct: Stats
+				Pending resources and their size in bytes ( see resource_size ), released ones are the
+				ones of the last begin_frame()
+		*/
+		struct Stats
+		{
+			u32 num_pending{ 0 };
+			u64 pending_size{ 0 };
+			u32 num_released{ 0 };
+			u64 released_size{ 0 };
+		};
+
+		DestructionQueue(u32 delay = features::destruction_delay);
+		~DestructionQueue() = default;
+
+		DestructionQueue(const DestructionQueue& other) = delete;
+		DestructionQueue& operator=(const DestructionQueue& other) = delete;
+
+		void push(u64 size, Release&& release);
+
+		/*
+			Function: begin_frame
+				Moves to the next frame and releases the resources pushed delay frames before
+		*/
+		void begin_frame();
+
+		/*
+			Function: flush
+				Releases everything right away, nothing can be in flight anymore ( e.g. GPUBackend::close )
+		*/
+		void flush();
+
+		u64 get_frame()const;
+		Stats get_stats()const;
+
+	private:
+		struct Entry
+		{
+			u64		frame;
+			u64		size;
+			Release release;
+		};
+
+		// Removes the first num_entries, called under the lock. They are released outside of it
+		std::vector<Entry> _pop(u32 num_entries);
+
+	private:
+		const u32 m_delay;
+
+		mutable std::mutex m_mutex;
+		std::deque<Entry>  m_entries;
+		u64				   m_frame;
+		Stats			   m_stats;
+	};
+}
@@ -1,30 +1,60 @@
-#pragma once
-
-// camy
-#include "base.hpp"
-
-namespace camy
-{
-	/*
-		Namespace: features
-			Most of the resource limits are listed here, they are not stricly related to the underlying API
-	*/
-	namespace features
-	{
-		const u32 max_bindable_vertex_buffers{ 32 };
-		const u32 max_bindable_render_targets{ 8 };
-
-		const u32 max_constant_buffer_size{ 1024 };
-
-		const u32 max_bindable_constant_buffers{ 14 };
-		const u32 max_bindable_samplers{ 16 };
-		const u32 max_bindable_shader_resources{ 128 };
-
-		// TODO : REMOVE
-		const u32 max_cbuffer_size{ 4096 * 16 };
-
-		const u32 max_cachable_rts{ 2 };
-		const u32 max_cachable_vbs{ 2 };
-		const u32 num_cache_slots{ 5 };
-	}
+#pragma once
+
+// camy
+#include "base.hpp"
+
+namespace camy
+{
+	/*
+		Namespace: features
+			Most of the resource limits are listed here, they are not stricly related to the underlying API
+	*/
+	namespace features
+	{
+		const u32 max_bindable_vertex_buffers{ 32 };
+		const u32 max_bindable_render_targets{ 8 };
+
+		const u32 max_constant_buffer_size{ 1024 };
+
+		const u32 max_bindable_constant_buffers{ 14 };
+		const u32 max_bindable_samplers{ 16 };
+		const u32 max_bindable_shader_resources{ 128 };
+
+		// TODO : REMOVE
+		const u32 max_cbuffer_size{ 4096 * 16 };
+
+		// Constant data is written in bulk to a per frame upload ring and bound by offset ( see CommandStream ),
+		// offsets and sizes are multiples of constant_data_alignment ( 16 constants, D3D11.1 granularity )
+		const u32 constant_data_alignment{ 256 };
+		const u32 constant_ring_size{ 1024 * 1024 * 4 };
+
+		// Bytes of initial data GPUBackend::process_uploads copies per frame ( see UploadQueue )
+		const u32 upload_budget{ 1024 * 1024 * 4 };
+
+		// Frames disposed resources are kept alive for ( see DestructionQueue ), streams are recorded up to
+		// LayerDispatcher::num_frames_in_flight frames ahead of the one being replayed and can still reference them
+		const u32 destruction_delay{ 3 };
+
+		const u32 max_cachable_rts{ 2 };
+		const u32 max_cachable_vbs{ 2 };
+		const u32 num_cache_slots{ 5 };
+
+		// Instancing, vertex shader inputs whose semantic starts with instance_semantic are read from the
+		// per instance stream bound at instance_buffer_slot ( see RenderLayer::set_instancing )
+		const u32  instance_buffer_slot{ 2 };
+		const u32  instance_buffer_size{ 1024 * 1024 * 4 };
+		const char instance_semantic[]{ "INSTANCE" };
+
+		// Default number of items a single queue ( and each of its recorders ) can hold, can be changed per queue
+		// ( see Queue::set_max_items ). Storage never reallocates, address space for all of them is reserved the first time
+		// an item is created ( see ReservedVector ). A queue reserves up to ( 2 + recorders used ) * max_queue_items * sizeof(item):
+		// the items, the reorder scratch ( only if set_reorder_items ) and one range per recorder actually used.
+		// With RenderItem under 256 bytes that is at most 256MB per range on 64 bit and 4MB on 32 bit, where the address space is
+		// 2GB for the whole process: small queues should lower it
+#if defined(_WIN64)
+		const u32 max_queue_items{ 1024 * 1024 };
+#else
+		const u32 max_queue_items{ 1024 * 16 };
+#endif
+	}
 }
\ No newline at end of file
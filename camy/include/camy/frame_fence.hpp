@@ -0,0 +1,46 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+
+// C++ STL
+#include <condition_variable>
+#include <mutex>
+
+namespace camy
+{
+	/*
+		Class: FrameFence
+			CPU side fence counting the completed frames. The thread consuming frames signals the number
+			of frames it has completed, the producer waits for a frame before reusing the storage associated
+			with it. Values are expected to be monotonically increasing.
+	*/
+	class FrameFence final
+	{
+	public:
+		FrameFence();
+		~FrameFence() = default;
+
+		FrameFence(const FrameFence& other) = delete;
+		FrameFence& operator=(const FrameFence& other) = delete;
+
+		/*
+			Function: signal
+				Sets the fence to value and wakes up the waiting threads
+		*/
+		void signal(u64 value);
+
+		/*
+			Function: wait
+				Blocks until the fence has reached value, returns immediately if it already has
+		*/
+		void wait(u64 value);
+
+		u64 get_value()const;
+
+	private:
+		mutable std::mutex		m_mutex;
+		std::condition_variable m_signaled;
+		u64						m_value;
+	};
+}
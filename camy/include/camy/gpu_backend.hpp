@@ -1,230 +1,494 @@
-#pragma once
-
-// camy
-#include "base.hpp"
-#include "resource_storer.hpp"
-#include "shader.hpp"
-#include "common_structs.hpp"
-#include "cbuffer_system.hpp"
-
-namespace camy
-{
-	// Forward declaration
-	class RenderLayer;
-	class ComputeLayer;
-	class PostProcessLayer;
-	struct PipelineCache;
-
-	class GPUBackend final
-	{
-	public:
-		GPUBackend();
-		~GPUBackend();
-
-		bool open(u32 adapter_index = 0);
-		void close();
-
-		// No purpose in moving / copying, since this is the "core" of the whole library
-		// It might have implications that have yet to be considered
-		GPUBackend(GPUBackend& other) = delete;
-		GPUBackend& operator=(GPUBackend& other) = delete;
-		GPUBackend(GPUBackend&& other) = delete;
-		GPUBackend& operator=(GPUBackend&& other) = delete;
-
-		/*
-			We could have had one more layer of abstraction where RenderItems are translated into commands as suggested by
-			hodgman http://www.gamedev.net/topic/636389-advanced-render-queue-api/
-			but to be honest there is no need for such a thing here *yet* might implement it later when supporting another backend,
-			the idea would be to execute on an already compiled command list instead of on a bunch of render layers
-		*/
-		void execute(const RenderLayer* render_layer);
-
-		void execute(const ComputeItem& compute_item);
-
-		void execute(const ComputeLayer* compute_layer);
-
-		void execute(const PostProcessLayer* pp_layer);
-
-		void update(const Buffer* buffer, const void* data);
-
-		// Black-box not intended to be used by the user, here just to mantain some encapsulation, the main reason is that inputs is dependant on the platform
-		
-		/*
-			All create functions
-		*/
-		
-		/*
-			Function:
-				Creates a new input signature, note that this if you are using the Shader class the input signature is created automatically
-				and this very function is more of a design-flaw. The inputs parameter is platform specific. 
-
-			compiled_bytecode - Vertex shader compiled bytecode for validation
-			bytecode_size	  - Size in bytes of the bytecode
-			inputs			  - Platform specific array of elements to create the input layout with ( D3D11_INPUT_ELEMENT_DESC )
-			num_imputs		  - Number of elements in the inputs array
-		*/
-		InputSignature* create_input_signature(const void* compiled_bytecode, Size bytecode_size, const void* inputs, Size num_inputs);
-
-		/*
-			Function: create_buffer
-				Creates a new buffer, can be of any of the types Buffer::Type for Vertex, Index and Constant buffers see respective create_**** functions,
-				buffers are bound as shader resources with samplers/textures etc...
-			
-			type - Type of the buffer
-			element_count - number of elements in the buffer
-			element_size - size of each element
-			For how to use the parameters see Buffer::Type
-		*/
-		Buffer* create_buffer(Buffer::Type type, u32 num_elements, u32 element_size, bool use_uav = false);
-
-		/*
-			Function: create_vertex_buffer
-				Creates a vertex buffer
-			
-			element_size	- size of each element
-			element_count	- number of elements in the buffer
-			data			- pointer to buffer of size element_size * element_count for initial data
-			is_dynamic		- true if you want the resource to be dynamic and easily updateable every frame
-		*/
-		VertexBuffer* create_vertex_buffer(u32 element_size, u32 num_elements, const void* data = nullptr, bool is_dynamic = false);
-		
-		/*
-			Function: create_index_buffer
-				Creates an index buffer
-
-			index_type		- specifies what type of index to use ( 16 or 32 bits)
-			element_count	- number of indices in the buffer
-			data			- data to initialize the buffer with
-			is_dynamic		- true if you want the resource to be dynamic 
-		*/
-		IndexBuffer* create_index_buffer(IndexBuffer::Type index_type, u32 num_elements, const void* data = nullptr, bool is_dynamic = false);
-		
-		/*
-			Function: create_constant_buffer
-				Use Shader <shader.hpp>
-		*/
-		ConstantBuffer* create_constant_buffer(u32 size);
-		
-		/*
-			Function: create_texture2D
-				Creates a surface used exclusively as input for a shader
-			
-			format - format used by the surface
-			width  - width in pixels
-			height - height in pixels
-			pitch  - If you are providing some initial data, this has to be the size in bytes of a row
-			data   - Initial data, size must be pitch * height
-			is_dynamic - true if you want the resource to be dynamic
-			msaa_level - is it an msaa_level, it has to be > 0
-		*/
-		Surface* create_texture2D(Surface::Format format, u32 width, u32 height, const SubSurface* subsurfaces = nullptr, u32 num_subsurfaces = 0, bool is_dynamic = false, u8 msaa_level = 1);
-		
-		/*
-			Function: create_render_target
-				Creates a surface usable as render target and shader input
-
-			format - depth/stencil format used by the surface
-			width  - width in pixels
-			height - height in pixels
-			msaa_level - is it an msaa_level, it has to be > 0
-		*/
-		Surface* create_render_target(Surface::Format format, u32 width, u32 height, u8 msaa_level = 1);
-		
-
-		/*
-			Function: create_depth_buffer
-				Creates a depth ( and possibly stencil ) buffer ( depending on the format ). Note that it is usable exclusively as 
-				depth view, nothing else!
-			format - depth/stencil format used by the surface
-			width  - width in pixels
-			height - height in pixels
-			msaa_level - is it an msaa_level, it has to be > 0
-		*/
-		Surface* create_depth_buffer(Surface::Format format, u32 width, u32 height, u8 msaa_level = 1);
-		
-		/*
-			Function: create_surface
-				Creates a surface that can be interpreter differently at different stages, all the pixel sizes have to match,
-				this is especially useful for e.g. shadow maps
-
-			description - full description of the surface
-			use_srv		- true if it will be serve as input for a hsader
-			use_rtv		- true if it will be used as render target
-			use_dsv		- true if it will be used as depth buffer
-		*/
-		Surface* create_surface(const Surface::Description& description, bool use_srv, bool use_rtv, bool use_dsv, bool use_uav = false, const SubSurface* subsurfaces = nullptr, u32 num_subsurfaces = 0);
-		
-		/*
-			Function: create_blend_state
-				Creates a blend state from one of the specific presets ( nothing custom is yet supported
-
-			blend_mode - Preset
-		*/
-		BlendState* create_blend_state(BlendState::Mode blend_mode);
-
-		/*
-			Function: create_rasterizer_state
-				Creates a rasterizer state 
-
-			see D3D11_RASTERIZER_DESC
-		*/
-		RasterizerState* create_rasterizer_state(RasterizerState::Cull cull, RasterizerState::Fill fill, u32 bias = 0, float bias_max = 0.f, float bias_slope = 0.f);
-		
-		/*
-			Function: create_sampler
-				Creates a sampler  ( N
-		*/
-		Sampler* create_sampler(Sampler::Filter filter, Sampler::Address address, Sampler::Comparison comparison = Sampler::Comparison::Never);
-		
-		/*
-			Function: create_shader
-				use Shader <shader.hpp>
-		*/
-		hidden::Shader* create_shader(Shader::Type type, const void* compiled_bytecode, Size bytecode_size);
-		
-		DepthStencilState* create_depth_stencil_state();
-
-		/*
-			Function: create_window_surface
-				creates a surface usable as render target and shader resource, format is R8G8B8A8 Unorm
-		*/
-		Surface* create_window_surface(WindowHandle window_handle, u8 msaa_level = 1);
-
-		template <typename Type>
-		void dispose(Type* ptr);
-
-		template <typename Type>
-		void safe_dispose(Type*& ptr);
-
-		void clear_surface(const Surface* surface, const float* color, const float depth, const u32 stencil);
-
-		void swap_buffers(const Surface* window_surface);
-
-	private:
-		bool create_builtin_resources();
-
-		// Functions are here merely for clarity in the execute(***) code
-		camy_inline void set_parameters(const ParameterGroup& parameters, PipelineCache& pipeline_cache);
-		camy_inline void set_parameter(const PipelineParameter& parameter, PipelineCache& pipeline_cache);
-		camy_inline void set_common_states(const CommonStates& common_states);
-		camy_inline void set_default_common_states();
-		camy_inline void unbind_dependency(const Dependency& dependency);
-
-	private:
-		ResourceStorer m_resources;
-		
-		CBufferSystem m_cbuffers[Shader::num_types];
-		CommonStates  m_default_states;
-
-		ID3D11Device*			m_device;
-		ID3D11DeviceContext*	m_context;
-		IDXGIFactory*			m_factory;
-		IDXGIAdapter*			m_adapter;
-		GraphicsAPIVersion		m_feature_level;
-		
-		// Built-in resources ( Todo: one all effects are implemented might move them somewhere else )
-		hidden::Shader*	m_postprocess_vs;
-	};
-}
-
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "resource_storer.hpp"
+#include "shader.hpp"
+#include "common_structs.hpp"
+#include "cbuffer_system.hpp"
+#include "command_stream.hpp"
+#include "pipeline_state.hpp"
+#include "upload_queue.hpp"
+#include "hazard_tracker.hpp"
+#include "pipeline_cache.hpp"
+#include "state_object_cache.hpp"
+#include "destruction_queue.hpp"
+#include "features.hpp"
+
+// C++ STL
+#include <vector>
+
+namespace camy
+{
+	// Forward declaration
+	class RenderLayer;
+	class ComputeLayer;
+	class PostProcessLayer;
+
+	/*
+		Class: GPUBackend
+			Owns the device and is the only place where the graphics API is called. The backend is chosen
+			at compile time: D3D11 by default, defining camy_backend_null builds the null backend instead
+			( src/null_backend.cpp ). The null backend creates fake resources that carry their descriptions 
+			but no API objects and, instead of replaying the streams, records what would have reached the 
+			device ( see Trace ). It is meant for measuring the CPU side ( culling, sorting, recording, 
+			compiling ) without a GPU, not for building on other platforms ( see config.hpp ).
+			A backend only ever sees CommandStreams, layers are compiled by the shared execute(layer) wrappers.
+			Adding one means a translation unit guarded by its define that defines the same members 
+			src/null_backend.cpp does: the public functions that reach the API ( open / close, create_*, update, 
+			clear_surface, swap_buffers, unbind* and execute(const CommandStream&) ), the private ones marked 
+			as backend specific below and whatever it declares in its own camy_backend_* blocks. 
+			Streams are already compiled in parallel ( see LayerDispatcher ), only their replay is serial.
+	*/
+	class GPUBackend final
+	{
+	public:
+		GPUBackend();
+		~GPUBackend();
+
+		bool open(u32 adapter_index = 0);
+		void close();
+
+		// No purpose in moving / copying, since this is the "core" of the whole library
+		// It might have implications that have yet to be considered
+		GPUBackend(GPUBackend& other) = delete;
+		GPUBackend& operator=(GPUBackend& other) = delete;
+		GPUBackend(GPUBackend&& other) = delete;
+		GPUBackend& operator=(GPUBackend&& other) = delete;
+
+		/*
+			Function: execute
+				Compiles the layer ( see CommandStream ) and replays it, the stream is reused across calls.
+				As suggested by hodgman http://www.gamedev.net/topic/636389-advanced-render-queue-api/
+				layers are translated into commands before reaching the device
+		*/
+		void execute(const RenderLayer* render_layer);
+
+		void execute(const ComputeItem& compute_item);
+
+		void execute(const ComputeLayer* compute_layer);
+
+		void execute(const PostProcessLayer* pp_layer);
+
+		/*
+			Function: execute
+				Replays an already compiled stream, everything referenced by the commands has to be still alive
+		*/
+		void execute(const CommandStream& stream);
+
+		void update(const Buffer* buffer, const void* data);
+
+		// Black-box not intended to be used by the user, here just to mantain some encapsulation, the main reason is that inputs is dependant on the platform
+		
+		/*
+			All create functions
+		*/
+		
+		/*
+			Function:
+				Creates a new input signature, note that this if you are using the Shader class the input signature is created automatically
+				and this very function is more of a design-flaw. The inputs parameter is platform specific. 
+
+			compiled_bytecode - Vertex shader compiled bytecode for validation
+			bytecode_size	  - Size in bytes of the bytecode
+			inputs			  - Platform specific array of elements to create the input layout with ( D3D11_INPUT_ELEMENT_DESC )
+			num_imputs		  - Number of elements in the inputs array
+		*/
+		InputSignature* create_input_signature(const void* compiled_bytecode, Size bytecode_size, const void* inputs, Size num_inputs);
+
+		/*
+			Function: create_buffer
+				Creates a new buffer, can be of any of the types Buffer::Type for Vertex, Index and Constant buffers see respective create_**** functions,
+				buffers are bound as shader resources with samplers/textures etc...
+			
+			type - Type of the buffer
+			element_count - number of elements in the buffer
+			element_size - size of each element
+			For how to use the parameters see Buffer::Type
+		*/
+		Buffer* create_buffer(Buffer::Type type, u32 num_elements, u32 element_size, bool use_uav = false);
+
+		/*
+			Function: create_vertex_buffer
+				Creates a vertex buffer
+			
+			element_size	- size of each element
+			element_count	- number of elements in the buffer
+			data			- pointer to buffer of size element_size * element_count for initial data
+			is_dynamic		- true if you want the resource to be dynamic and easily updateable every frame
+		*/
+		VertexBuffer* create_vertex_buffer(u32 element_size, u32 num_elements, const void* data = nullptr, bool is_dynamic = false);
+		
+		/*
+			Function: create_index_buffer
+				Creates an index buffer
+
+			index_type		- specifies what type of index to use ( 16 or 32 bits)
+			element_count	- number of indices in the buffer
+			data			- data to initialize the buffer with
+			is_dynamic		- true if you want the resource to be dynamic 
+		*/
+		IndexBuffer* create_index_buffer(IndexBuffer::Type index_type, u32 num_elements, const void* data = nullptr, bool is_dynamic = false);
+		
+		/*
+			Function: create_constant_buffer
+				Use Shader <shader.hpp>
+		*/
+		ConstantBuffer* create_constant_buffer(u32 size);
+		
+		/*
+			Function: create_texture2D
+				Creates a surface used exclusively as input for a shader
+			
+			format - format used by the surface
+			width  - width in pixels
+			height - height in pixels
+			pitch  - If you are providing some initial data, this has to be the size in bytes of a row
+			data   - Initial data, size must be pitch * height
+			is_dynamic - true if you want the resource to be dynamic
+			msaa_level - is it an msaa_level, it has to be > 0
+		*/
+		Surface* create_texture2D(Surface::Format format, u32 width, u32 height, const SubSurface* subsurfaces = nullptr, u32 num_subsurfaces = 0, bool is_dynamic = false, u8 msaa_level = 1);
+
+		/*
+			Function: create_vertex_buffer_async
+				Same as create_vertex_buffer, but the initial data is copied to the buffer by the following 
+				process_uploads() calls instead of at creation. The buffer is returned right away with is_ready 
+				false, data is copied and can be released. Can be called from any thread, as the other _async ones.
+				Only static resources can be created this way
+		*/
+		VertexBuffer* create_vertex_buffer_async(u32 element_size, u32 num_elements, const void* data);
+
+		/*
+			Function: create_index_buffer_async
+				See create_vertex_buffer_async
+		*/
+		IndexBuffer* create_index_buffer_async(IndexBuffer::Type index_type, u32 num_elements, const void* data);
+
+		/*
+			Function: create_texture2D_async
+				See create_vertex_buffer_async, one subsurface per mip level
+		*/
+		Surface* create_texture2D_async(Surface::Format format, u32 width, u32 height, const SubSurface* subsurfaces, u32 num_subsurfaces);
+
+		/*
+			Function: process_uploads
+				Copies up to budget bytes of the pending async uploads, the LayerDispatcher calls it once per frame
+				before replaying. Has to be called by the thread using the device context
+		*/
+		void process_uploads(u64 budget = features::upload_budget);
+
+		/*
+			Function: get_upload_stats
+				Bytes uploaded and latency of the last process_uploads() ( see UploadQueue::Stats )
+		*/
+		UploadQueue::Stats get_upload_stats()const { return m_uploads.get_stats(); }
+
+		/*
+			Function: begin_frame
+				Releases the resources disposed features::destruction_delay frames ago, the LayerDispatcher calls
+				it once per frame before replaying. Has to be called by the thread using the device context
+		*/
+		void begin_frame();
+
+		/*
+			Function: get_destruction_stats
+				Resources disposed but not released yet and the ones released by the last begin_frame()
+		*/
+		DestructionQueue::Stats get_destruction_stats()const { return m_destruction.get_stats(); }
+		
+		/*
+			Function: create_render_target
+				Creates a surface usable as render target and shader input
+
+			format - depth/stencil format used by the surface
+			width  - width in pixels
+			height - height in pixels
+			msaa_level - is it an msaa_level, it has to be > 0
+		*/
+		Surface* create_render_target(Surface::Format format, u32 width, u32 height, u8 msaa_level = 1);
+		
+
+		/*
+			Function: create_depth_buffer
+				Creates a depth ( and possibly stencil ) buffer ( depending on the format ). Note that it is usable exclusively as 
+				depth view, nothing else!
+			format - depth/stencil format used by the surface
+			width  - width in pixels
+			height - height in pixels
+			msaa_level - is it an msaa_level, it has to be > 0
+		*/
+		Surface* create_depth_buffer(Surface::Format format, u32 width, u32 height, u8 msaa_level = 1);
+		
+		/*
+			Function: create_surface
+				Creates a surface that can be interpreter differently at different stages, all the pixel sizes have to match,
+				this is especially useful for e.g. shadow maps. subsurfaces can be null with num_subsurfaces > 0 to 
+				create the mip levels without initial data
+
+			description - full description of the surface
+			use_srv		- true if it will be serve as input for a hsader
+			use_rtv		- true if it will be used as render target
+			use_dsv		- true if it will be used as depth buffer
+		*/
+		Surface* create_surface(const Surface::Description& description, bool use_srv, bool use_rtv, bool use_dsv, bool use_uav = false, const SubSurface* subsurfaces = nullptr, u32 num_subsurfaces = 0);
+		
+		/*
+			Function: create_blend_state
+				Creates a blend state from one of the specific presets ( nothing custom is yet supported.
+				As the other state objects ( rasterizer, depth stencil states and samplers ) equal states share
+				the same object, it's reference counted and has to be disposed once per create call
+
+			blend_mode - Preset
+		*/
+		BlendState* create_blend_state(BlendState::Mode blend_mode);
+
+		/*
+			Function: create_rasterizer_state
+				Creates a rasterizer state 
+
+			see D3D11_RASTERIZER_DESC
+		*/
+		RasterizerState* create_rasterizer_state(RasterizerState::Cull cull, RasterizerState::Fill fill, u32 bias = 0, float bias_max = 0.f, float bias_slope = 0.f);
+		
+		/*
+			Function: create_sampler
+				Creates a sampler  ( N
+		*/
+		Sampler* create_sampler(Sampler::Filter filter, Sampler::Address address, Sampler::Comparison comparison = Sampler::Comparison::Never);
+		
+		/*
+			Function: create_shader
+				use Shader <shader.hpp>
+		*/
+		hidden::Shader* create_shader(Shader::Type type, const void* compiled_bytecode, Size bytecode_size);
+		
+		DepthStencilState* create_depth_stencil_state();
+
+		/*
+			Function: create_pipeline_state
+				Returns the immutable pipeline state for the description, equal descriptions share the same object.
+				Pipeline states live until close(), the shaders and states they reference have to outlive them.
+				nullptr if too many unique states / shaders have been used ( see PipelineState )
+		*/
+		const PipelineState* create_pipeline_state(const PipelineState::Description& description);
+
+		/*
+			Function: get_num_state_objects
+				Unique blend, rasterizer, depth stencil states and samplers alive ( see create_blend_state )
+		*/
+		u32 get_num_state_objects()const;
+
+		/*
+			Function: create_window_surface
+				creates a surface usable as render target and shader resource, format is R8G8B8A8 Unorm
+		*/
+		Surface* create_window_surface(WindowHandle window_handle, u8 msaa_level = 1);
+
+		/*
+			Function: dispose
+				Releases the resource once the frames in flight can't reference it anymore ( see begin_frame ),
+				it can't be used from now on. Pending async uploads are cancelled right away.
+				Can be called from any thread
+		*/
+		template <typename Type>
+		void dispose(Type* ptr);
+
+		template <typename Type>
+		void safe_dispose(Type*& ptr);
+
+		void clear_surface(const Surface* surface, const float* color, const float depth, const u32 stencil);
+
+		void swap_buffers(const Surface* window_surface);
+
+		/*
+			Function: unbind
+				Unbinds whatever is bound through dependency. Not needed to resolve hazards, views are unbound
+				as soon as they conflict with a new bind ( see HazardTracker )
+		*/
+		void unbind(const Dependency& dependency);
+
+		/*
+			Function: unbind_outputs
+				Unbinds render targets and depth buffer ( and resets the other common states ), a surface 
+				still bound as output can't be read as shader resource
+		*/
+		void unbind_outputs();
+
+#if defined(camy_backend_null)
+		/*
+			Struct: Trace
+				Counters of what has been executed since the last reset_trace(). State binds are common states,
+				vertex / index buffers, topology and shaders, parameter binds are ranges of samplers, surfaces and buffers
+				covering bound_parameters slots ( redundant if all the slots were already set ).
+				A bind is redundant if it sets what is already bound, streams are compiled independently 
+				thus binds are often redundant with what the previous stream left. Unbinds are the explicit
+				ones, hazard unbinds are the views unbound because they conflicted with a new bind ( see HazardTracker ).
+				Constant data is copied once per stream to the upload ring ( cbuffer uploads ) and then bound
+				by offset ( cbuffer binds ). Resource uploads are the copies issued by process_uploads()
+		*/
+		struct Trace
+		{
+			u32 num_commands{ 0 };
+			u32 num_state_binds{ 0 };
+			u32 num_redundant_state_binds{ 0 };
+			u32 num_parameter_binds{ 0 };
+			u32 num_redundant_parameter_binds{ 0 };
+			u32 num_bound_parameters{ 0 };
+			u32 num_unbinds{ 0 };
+			u32 num_hazard_unbinds{ 0 };
+			u32 num_cbuffer_uploads{ 0 };
+			u64 cbuffer_upload_size{ 0 };
+			u32 num_cbuffer_binds{ 0 };
+			u32 num_buffer_updates{ 0 };
+			u64 buffer_update_size{ 0 };
+			u32 num_resource_uploads{ 0 };
+			u64 resource_upload_size{ 0 };
+			u64 instance_upload_size{ 0 };
+			u32 num_clears{ 0 };
+			u32 num_draws{ 0 };
+			u64 num_instances{ 0 };
+			u64 num_indices{ 0 };
+			u32 num_dispatches{ 0 };
+			u32 num_presents{ 0 };
+		};
+
+		/*
+			Struct: TraceEntry
+				A single command, recorded only if set_trace_commands( true )
+		*/
+		struct TraceEntry
+		{
+			CommandType type;
+			bool		redundant;
+			u32			size;	// Bytes uploaded if any
+		};
+
+		const Trace& get_trace()const { return m_trace; }
+		const std::vector<TraceEntry>& get_trace_entries()const { return m_trace_entries; }
+		void set_trace_commands(bool trace_commands) { m_trace_commands = trace_commands; }
+		void reset_trace();
+#else
+		/*
+			Function: get_bind_stats
+				API binds issued and skipped because the device already had that state bound ( see PipelineCache ),
+				since the last reset_bind_stats(). The null backend reports the same as redundant binds in Trace
+		*/
+		const PipelineCache::Stats& get_bind_stats()const { return m_pipeline_cache.get_stats(); }
+		void reset_bind_stats() { m_pipeline_cache.reset_stats(); }
+#endif
+
+	private:
+		// Backend specific
+		bool create_builtin_resources();
+
+		// Unbinds the views conflicting with binding resource with usage, called before every bind of 
+		// surfaces and buffers. unbind_view is backend specific and doesn't touch the tracker
+		void resolve_hazards(const void* resource, HazardTracker::Usage usage);
+		void unbind_view(const HazardTracker::View& view);
+
+		// Backend specific, binds features::max_cachable_rts render targets and the depth buffer, any of them can be null
+		void set_outputs(const Surface* const* render_targets, const Surface* depth_buffer);
+
+		// Backend specific, copies a chunk queued by process_uploads() to its resource
+		void upload(const UploadQueue::Chunk& chunk);
+
+		// Drops a reference to a shared state object, true if it has to be deallocated. Anything that is not
+		// a state object is always deallocated
+		template <typename Type>
+		bool release_state_object(const Type* ptr) { return true; }
+		bool release_state_object(const BlendState* blend_state) { return m_blend_states.release(blend_state); }
+		bool release_state_object(const RasterizerState* rasterizer_state) { return m_rasterizer_states.release(rasterizer_state); }
+		bool release_state_object(const DepthStencilState* depth_stencil_state) { return m_depth_stencil_states.release(depth_stencil_state); }
+		bool release_state_object(const Sampler* sampler) { return m_samplers.release(sampler); }
+		void clear_state_objects();
+
+#if defined(camy_backend_null)
+		// Shadow of what would be bound on the device, used to detect redundant binds
+		struct BoundState
+		{
+			CommonStates		common_states;
+			bool				default_common_states;
+			const VertexBuffer* vertex_buffers[2];
+			const IndexBuffer*	index_buffer;
+			PrimitiveTopology	primitive_topology;
+			const Shader*		shaders[Shader::num_types];
+			u32					states_set;
+
+			// [shader type][bind type][is uav][slot]
+			const void* parameters[Shader::num_types][4][2][features::max_bindable_shader_resources];
+		};
+
+		void trace(CommandType type, bool redundant, u32 size = 0);
+		void reset_bound_state();
+		const void** bound_parameter(const ShaderVariable& variable);
+#else
+
+		// Functions are here merely for clarity in the execute(***) code
+		camy_inline void set_parameters(const ParameterGroup& parameters);
+		camy_inline void set_parameter(const PipelineParameter& parameter);
+		camy_inline void set_common_states(const CommonStates& common_states, u32 parts = CommonStatesParts_All);
+		camy_inline void set_default_common_states();
+		camy_inline void set_constants(const ShaderVariable& shader_variable, u32 ring_offset);
+		camy_inline void unbind_dependency(const Dependency& dependency);
+		void bind_range(const BindRangeCommand& command);
+		void bind_tracked_outputs();
+		void execute_postprocess(const PostProcessCommand& command);
+		
+		// Reserves size bytes aligned to alignment in the ring buffer and maps them, returns null on failure.
+		// The ring is written linearly and discarded once full
+		void* map_ring(ID3D11Buffer* buffer, u32 ring_size, u32& ring_offset, u32 size, u32 alignment, u32& offset_out);
+#endif
+
+	private:
+		ResourceStorer m_resources;
+
+#if defined(camy_backend_null)
+		Trace m_trace;
+		std::vector<TraceEntry> m_trace_entries;
+		bool m_trace_commands;
+		BoundState m_bound;
+#else
+		// Fallback for runtimes without constant buffer offsetting ( D3D11.0 ), see m_constant_ring
+		CBufferSystem m_cbuffers[Shader::num_types];
+		CommonStates  m_default_states;
+
+		ID3D11Device*			m_device;
+		ID3D11DeviceContext*	m_context;
+		ID3D11DeviceContext1*	m_context1; // Null if constant buffer offsetting is not supported
+		IDXGIFactory*			m_factory;
+		IDXGIAdapter*			m_adapter;
+		GraphicsAPIVersion		m_feature_level;
+		
+		// Built-in resources ( Todo: one all effects are implemented might move them somewhere else )
+		hidden::Shader*	m_postprocess_vs;
+
+		// Per instance stream shared by all the instanced layers, written linearly and discarded once full
+		VertexBuffer*	m_instance_buffer;
+		u32				m_instance_buffer_offset;
+
+		// Upload ring the constant data of the streams is copied to, one map per stream, bound by offset
+		ConstantBuffer* m_constant_ring;
+		u32				m_constant_ring_offset;
+
+		// What is bound to m_context, every bind goes through it
+		PipelineCache	m_pipeline_cache;
+#endif
+
+		PipelineStateCache m_pipeline_states;
+		UploadQueue		   m_uploads;
+		HazardTracker	   m_hazards;
+		DestructionQueue   m_destruction;
+
+		// Hash-consed state objects, the depth stencil state has a single preset for now
+		StateObjectCache<BlendState, BlendState::Description>			  m_blend_states;
+		StateObjectCache<RasterizerState, RasterizerState::Description> m_rasterizer_states;
+		StateObjectCache<DepthStencilState, u32>						  m_depth_stencil_states;
+		StateObjectCache<Sampler, Sampler::Description>				  m_samplers;
+
+		// Scratch stream for the execute(layer) calls
+		CommandStream	m_stream;
+	};
+}
+
 #include "gpu_backend.inl"
\ No newline at end of file
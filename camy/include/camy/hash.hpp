@@ -0,0 +1,39 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+
+namespace camy
+{
+	/*
+		Function: fnv1a
+			32 bit FNV-1a, shared by everything that hashes names or descriptions: shader variables
+			( see ShaderVariableName ), state objects and pipeline states. The string overload stops at the
+			terminator and is usable in constant expressions, a string hashes the same through both overloads.
+			Not meant for anything but bucketing, equal hashes have to be compared by value
+	*/
+	constexpr u32 fnv1a_offset_basis{ 2166136261u };
+	constexpr u32 fnv1a_prime{ 16777619u };
+
+	namespace hidden
+	{
+		constexpr u32 fnv1a_string(const char* str, u32 hash)
+		{
+			return *str == '\0' ? hash : fnv1a_string(str + 1, (hash ^ static_cast<u8>(*str)) * fnv1a_prime);
+		}
+	}
+
+	constexpr u32 fnv1a(const char* str)
+	{
+		return hidden::fnv1a_string(str, fnv1a_offset_basis);
+	}
+
+	inline u32 fnv1a(const void* data, Size size, u32 hash = fnv1a_offset_basis)
+	{
+		auto bytes{ static_cast<const Byte*>(data) };
+		for (Size i{ 0 }; i < size; ++i)
+			hash = (hash ^ bytes[i]) * fnv1a_prime;
+
+		return hash;
+	}
+}
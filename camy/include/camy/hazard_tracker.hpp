@@ -0,0 +1,84 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "features.hpp"
+#include "shader.hpp"
+
+namespace camy
+{
+	/*
+		Class: HazardTracker
+			Shadow of the surfaces and buffers bound to the device: shader resources per stage and slot, compute
+			unordered access views, render targets and depth buffer. A resource can be bound with a single usage
+			at a time, D3D11 silently drops a shader resource whose resource is bound as output ( and the other
+			way around ), thus before every bind the backend unbinds the views of the resource that have
+			a different usage ( see GPUBackend::resolve_hazards ). Nothing else is unbound, views stay bound
+			across items, layers and frames until they get in the way.
+			Resources are identified by address, as PipelineParameter::data.
+	*/
+	class HazardTracker final
+	{
+	public:
+		enum class Usage : u8
+		{
+			ShaderResource,
+			UnorderedAccess, // Compute only
+			RenderTarget,
+			DepthStencil
+		};
+
+		struct View
+		{
+			Usage usage;
+			u8	  shader_type; // Shader resources only
+			u16	  slot;		   // Ignored for the depth stencil
+		};
+
+		static const u32 max_conflicts{ 8 };
+
+		HazardTracker();
+		~HazardTracker() = default;
+
+		/*
+			Function: conflicts
+				True if a resource bound with usage a can't be bound with usage b at the same time
+		*/
+		static bool conflicts(Usage a, Usage b) { return a != b; }
+
+		/*
+			Function: find_conflicts
+				Writes to views where resource is bound with a conflicting usage, max_conflicts at most.
+				They have to be unbound and set() to null before binding the resource, thus calling it again
+				returns the next ones
+		*/
+		u32 find_conflicts(const void* resource, Usage usage, View* views)const;
+
+		/*
+			Function: set
+				Records a bind, null if unbound. Out of range views are ignored
+		*/
+		void set(const View& view, const void* resource);
+		const void* get(const View& view)const;
+
+		/*
+			Function: forget
+				Resource is being released, its views are not tracked anymore
+		*/
+		void forget(const void* resource);
+
+		void reset();
+
+	private:
+		static const u32 max_slots{ features::max_bindable_shader_resources };
+
+		const void* m_shader_resources[Shader::num_types][max_slots];
+		const void* m_unordered_access[max_slots];
+		const void* m_render_targets[features::max_cachable_rts];
+		const void* m_depth_buffer;
+
+		// One past the highest slot ever set, slots are scanned up to here
+		u32 m_shader_resources_end[Shader::num_types];
+		u32 m_unordered_access_end;
+	};
+}
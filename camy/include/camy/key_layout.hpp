@@ -0,0 +1,183 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+
+// C++ STL
+#include <cstring>
+#include <type_traits>
+
+namespace camy
+{
+	/*
+		Topic: Key layouts
+			Sort keys are made of a bunch of bit fields, the most significant one is the one that matters
+			most when sorting. Instead of shifting and masking by hand ( and silently overflowing into the
+			next field ) the layout is declared once:
+				struct Depth { };
+				struct Material { };
+				using Layout = KeyLayout<u64, KeyField<Depth, 24>, KeyField<Material, 16>>;
+				auto key{ Layout::pack<Depth>(d) | Layout::pack<Material>(m) };
+			Fields are listed from the most significant to the least significant, offsets and masks are
+			computed at compile time and a layout that doesn't fit the key does not compile. Fields are
+			identified by a tag type, this way the same tags can be shared by layouts with different orderings.
+			Functions are C++11 constexpr ( single expression ) because of VS2015
+	*/
+	template <typename Tag, u32 num_bits>
+	struct KeyField
+	{
+		using tag = Tag;
+		static const u32 bits{ num_bits };
+
+		static_assert(num_bits > 0, "Key fields must be at least 1 bit wide");
+	};
+
+	namespace hidden
+	{
+		template <typename Type>
+		struct KeyAlwaysFalse : std::false_type { };
+
+		// Total number of bits of the fields
+		template <typename... Fields>
+		struct KeyBitSum;
+
+		template <>
+		struct KeyBitSum<>
+		{
+			static const u32 value{ 0 };
+		};
+
+		template <typename First, typename... Rest>
+		struct KeyBitSum<First, Rest...>
+		{
+			static const u32 value{ First::bits + KeyBitSum<Rest...>::value };
+		};
+
+		template <u32 num_bits, u32 field_offset>
+		struct KeyFieldInfo
+		{
+			static const u32 bits{ num_bits };
+			static const u32 offset{ field_offset };
+		};
+
+		// Looks for Tag, the offset of a field is the size of all the fields following it
+		template <typename Tag, typename... Fields>
+		struct KeyFieldLookup
+		{
+			static_assert(KeyAlwaysFalse<Tag>::value, "Field is not part of the key layout");
+		};
+
+		template <typename Tag, typename First, typename... Rest>
+		struct KeyFieldLookup<Tag, First, Rest...> :
+			std::conditional<std::is_same<Tag, typename First::tag>::value,
+				KeyFieldInfo<First::bits, KeyBitSum<Rest...>::value>,
+				KeyFieldLookup<Tag, Rest...>>::type
+		{
+
+		};
+	}
+
+	/*
+		Class: KeyLayout
+			Generates the pack/unpack code for the specified fields, see Topic: Key layouts
+	*/
+	template <typename KeyType, typename... Fields>
+	class KeyLayout final
+	{
+	public:
+		using Key = KeyType;
+
+		static const u32 num_fields{ sizeof...(Fields) };
+		static const u32 num_bits{ hidden::KeyBitSum<Fields...>::value };
+
+		static_assert(std::is_unsigned<KeyType>::value, "Keys have to be unsigned integers");
+		static_assert(num_bits <= sizeof(KeyType) * 8, "Key layout does not fit in the key type");
+
+		/*
+			Struct: Field
+				Compile time description of a single field
+		*/
+		template <typename Tag>
+		struct Field
+		{
+			static const u32 bits{ hidden::KeyFieldLookup<Tag, Fields...>::bits };
+			static const u32 offset{ hidden::KeyFieldLookup<Tag, Fields...>::offset };
+
+			static const KeyType max_value{ bits >= sizeof(KeyType) * 8 ? static_cast<KeyType>(~KeyType(0)) : static_cast<KeyType>((KeyType(1) << (bits % (sizeof(KeyType) * 8))) - 1) };
+			static const KeyType mask{ static_cast<KeyType>(max_value << offset) };
+		};
+
+		/*
+			Struct: Constant
+				Packs a value known at compile time, the value not fitting in the field is a compile error
+		*/
+		template <typename Tag, KeyType value>
+		struct Constant
+		{
+			static_assert(value <= Field<Tag>::max_value, "Value does not fit in the key field");
+			static const KeyType key{ static_cast<KeyType>(value << Field<Tag>::offset) };
+		};
+
+		/*
+			Function: fits
+				True if value can be stored in the field without losing bits
+		*/
+		template <typename Tag>
+		static constexpr bool fits(KeyType value)
+		{
+			return value <= Field<Tag>::max_value;
+		}
+
+		/*
+			Function: pack
+				Moves the value in position, bits that don't fit are discarded and do not leak into
+				the other fields. Use fits() or Constant if truncation is not acceptable
+		*/
+		template <typename Tag>
+		static constexpr KeyType pack(KeyType value)
+		{
+			return static_cast<KeyType>((value & Field<Tag>::max_value) << Field<Tag>::offset);
+		}
+
+		/*
+			Function: unpack
+				Extracts the value of the field from the key
+		*/
+		template <typename Tag>
+		static constexpr KeyType unpack(KeyType key)
+		{
+			return static_cast<KeyType>((key >> Field<Tag>::offset) & Field<Tag>::max_value);
+		}
+
+		/*
+			Function: replace
+				Returns the key with the field set to value, the other fields are left untouched
+		*/
+		template <typename Tag>
+		static constexpr KeyType replace(KeyType key, KeyType value)
+		{
+			return static_cast<KeyType>((key & ~Field<Tag>::mask) | pack<Tag>(value));
+		}
+
+		/*
+			Function: quantize
+				Converts a non-negative float ( e.g. view space depth ) into the most significant
+				bits of its representation. IEEE754 positive floats compare as their integer bits, thus the order
+				is preserved without knowing the range in advance, the precision is relative to the magnitude
+				( like a logarithmic depth ). Negatives and NaNs map to 0
+		*/
+		template <typename Tag>
+		static KeyType quantize(float value)
+		{
+			static_assert(Field<Tag>::bits <= 31, "Quantized fields can't be wider than 31 bits");
+
+			if (!(value > 0.f))
+				return 0;
+
+			u32 bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+
+			return static_cast<KeyType>(bits >> (31 - Field<Tag>::bits));
+		}
+	};
+}
@@ -1,31 +1,200 @@
-#pragma once
-
-// camy
-#include "layers.hpp"
-
-// C++ STL
-#include <vector>
-
-namespace camy
-{
-	class LayerDispatcher final
-	{
-	public:
-		LayerDispatcher() = default;
-		~LayerDispatcher() = default;
-
-		// Copying makes sense, there is no problem in it
-		LayerDispatcher(const LayerDispatcher& other) = default;
-		LayerDispatcher& operator=(const LayerDispatcher& other) = default;
-
-		void add_layer(Layer* render_layer);
-		void dispatch();
-		void remove_layer(Layer* render_layer);
-
-	private:
-		void _validate_layers();
-
-		std::vector<Layer*>	m_layers;
-		std::vector<bool>	m_bitmask;
-	};
-}
\ No newline at end of file
+#pragma once
+
+// camy
+#include "layers.hpp"
+#include "command_stream.hpp"
+#include "frame_fence.hpp"
+#include "worker_pool.hpp"
+
+// C++ STL
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace camy
+{
+	/*
+		Class: LayerDispatcher
+			Executes the layers in an order that respects their dependencies. Every dispatch() the layers are
+			turned into a graph: two layers accessing the same resource ( see Layer::reads / Layer::writes ), with
+			at least one of them writing it, are executed in pass order ( insertion order for the same pass ).
+			Layers that don't declare resources are treated as barriers and keep the old pass ordering.
+			From the graph :
+				- Layers whose writes nobody consumes are culled. A layer is consumed if it writes one of the outputs
+				  ( see add_output ) or a resource accessed by a layer that is consumed. Layers that don't declare
+				  any write can't be reasoned about and are never culled.
+				- Independent layers are scheduled so that layers rendering to the same target are executed back to back
+			Layers that are not ready when dispatching are skipped, there is no waiting. Hazards ( a resource bound 
+			as shader resource by a layer and as output by the next one ) are resolved by the backend when binding
+			( see HazardTracker ), declarations only drive the order.
+			Scheduled layers are first compiled into CommandStreams, in parallel if workers have been
+			requested ( see set_num_workers ), then the streams are replayed on the backend in schedule order.
+
+			Frames can be pipelined ( see set_pipelined ): the streams are replayed by a render thread while the
+			calling thread records the next frame. Streams are snapshots of the layers ( see Topic: Command streams ),
+			once compiled the layers are handed back and can begin() again, up to num_frames_in_flight frames of
+			streams exist at the same time.
+	*/
+	class LayerDispatcher final
+	{
+	public:
+		/*
+			Edges are stored as bitmasks, it is way more than what a frame usually needs
+		*/
+		static const u32 max_layers{ 64 };
+
+		/*
+			Frames compiled but not yet replayed, dispatch() waits for the oldest one when all of them are in use
+		*/
+		static const u32 num_frames_in_flight{ 2 };
+
+		LayerDispatcher();
+		~LayerDispatcher();
+
+		// Owns the worker and render threads
+		LayerDispatcher(const LayerDispatcher& other) = delete;
+		LayerDispatcher& operator=(const LayerDispatcher& other) = delete;
+
+		void add_layer(Layer* render_layer);
+		void remove_layer(Layer* render_layer);
+
+		/*
+			Function: add_output
+				Marks a resource as result of the frame ( e.g. the window surface ), layers contributing
+				to it are never culled
+		*/
+		void add_output(const PipelineResource* resource);
+		void remove_output(const PipelineResource* resource);
+		void clear_outputs() { m_outputs.clear(); }
+
+		/*
+			Function: set_num_workers
+				Number of threads compiling the layers other than the one calling dispatch(), 0 ( default )
+				compiles serially. Layers are only read while compiling, nothing is shared in between streams
+		*/
+		void set_num_workers(u32 num_workers);
+		u32 get_num_workers()const { return m_workers == nullptr ? 0 : m_workers->get_num_threads() - 1; }
+
+		/*
+			Function: set_pipelined
+				Starts ( or stops after waiting the frames in flight ) the render thread replaying the frames.
+				While pipelined nothing else should touch the backend context from other threads: clears and
+				buffer updates go through get_frame_commands(). Resources referenced by a frame can't be
+				disposed before it has been replayed, see flush()
+		*/
+		void set_pipelined(bool pipelined);
+		bool is_pipelined()const { return m_render_thread.joinable(); }
+
+		/*
+			Function: dispatch
+				Compiles the layers into a new frame and submits it, replaying it immediately if not pipelined.
+				If present_surface is not null it is presented once the frame has been replayed
+		*/
+		void dispatch(const Surface* present_surface = nullptr);
+
+		/*
+			Function: flush
+				Waits until all the dispatched frames have been replayed
+		*/
+		void flush();
+
+		/*
+			Function: get_frame_commands
+				Commands replayed before the layers of the frame being recorded, used for clears and 
+				buffer updates. Only the thread calling dispatch() can record
+		*/
+		CommandStream& get_frame_commands() { return m_frame_commands; }
+
+		/*
+			Function: get_fence
+				Signaled with the number of frames that have been replayed
+		*/
+		FrameFence& get_fence() { return m_fence; }
+		u64 get_num_dispatched_frames()const { return m_num_frames; }
+
+		/*
+			Function: get_schedule
+				Layers in the order they have been executed the last time dispatch() has been called, culled
+				layers are not present
+		*/
+		Layer* const* get_schedule()const { return m_schedule.empty() ? nullptr : &m_schedule[0]; }
+		u32 get_schedule_size()const { return static_cast<u32>(m_schedule.size()); }
+
+		/*
+			Function: get_num_culled_layers
+				Number of layers that have not been executed because nobody consumes their output
+		*/
+		u32 get_num_culled_layers()const { return static_cast<u32>(m_layers.size() - m_schedule.size()); }
+
+		/*
+			Function: get_command_streams
+				Streams compiled the last time dispatch() has been called, one per schedule entry. Streams of layers 
+				that were not ready are empty
+		*/
+		const CommandStream* get_command_streams()const;
+
+	private:
+		void _sort_layers();
+		void _build_graph();
+		void _cull();
+		void _schedule();
+		void _compile(u32 schedule_index, CommandStream& stream);
+
+		/*
+			Struct: Node
+				Layer in the graph, indices in the bitmasks are indices in m_layers
+		*/
+		struct Node
+		{
+			u64  successors;	// Have to be executed after this
+			u64  consumers;		// Successors that access what this writes, alive if any of them is
+			u32	 num_predecessors;
+			bool is_root;
+			bool is_alive;
+
+			// Render target, used to group layers
+			const PipelineResource* target;
+		};
+
+		bool _writes(const Layer* layer, const PipelineResource* resource)const;
+		bool _reads(const Layer* layer, const PipelineResource* resource)const;
+
+		/*
+			Struct: Frame
+				Everything the render thread needs to replay a frame, owned by it until the fence has been signaled
+		*/
+		struct Frame
+		{
+			CommandStream commands;
+			std::vector<CommandStream> streams;
+			u32 num_streams{ 0 };
+			const Surface* present_surface{ nullptr };
+		};
+
+		void _replay(const Frame& frame);
+		void _render_thread();
+
+		std::vector<Layer*>	m_layers;
+		std::vector<const PipelineResource*> m_outputs;
+
+		// Rebuilt every dispatch() reusing the memory
+		std::vector<Node>	m_nodes;
+		std::vector<Layer*>	m_schedule;
+		std::vector<u32>	m_schedule_nodes;
+
+		WorkerPool* m_workers;
+
+		Frame		  m_frames[num_frames_in_flight];
+		CommandStream m_frame_commands;
+		u64			  m_num_frames;
+		FrameFence	  m_fence;
+
+		// Render thread, m_num_submitted_frames and m_quit are protected by m_submit_mutex
+		std::thread				m_render_thread;
+		std::mutex				m_submit_mutex;
+		std::condition_variable m_submitted;
+		u64						m_num_submitted_frames;
+		bool					m_quit;
+	};
+}
@@ -1,173 +1,285 @@
-#pragma once
-
-// camy
-#include "base.hpp"
-#include "common_structs.hpp"
-#include "queue.hpp"
-
-// C++ STL
-#include <vector>
-
-namespace camy
-{
-	// Forward declaration
-	class Context;
-
-	struct RenderItem;
-	struct ParameterGroup;
-
-	class Layer
-	{
-	public:
-		/*
-			Enum: Layer::Order
-			How this pass should be executed compared to the others.
-			Note:
-			Remember that gaps cannot exist :)
-		*/
-		enum class Order
-		{
-			Ordered,	// Has a specific pass N and is executed before the pass N+1 and after the pass N-1
-			Unordered,	// Doesn't matter, can be executed whenever needed
-		};
-
-		/*
-			Shall i use the same Queue::State ? 
-		*/
-		enum class State
-		{
-			Executed,
-			Queueing,
-			Ready,
-			Permanent // Exception for PostProcessLayer
-		};
-
-	public:
-		enum class Type
-		{
-			Render,
-			Compute,
-			PostProcess
-		};
-
-		Layer(Type type, Order order, u32 pass) : m_type{ type }, m_order{ order }, m_pass{ pass }, m_state{ State::Executed } { }
-		virtual ~Layer() = default;
-		
-		Type get_type()const { return m_type; }
-		Order get_order()const { return m_order; }
-		u32 get_pass()const { return m_pass; }
-		State get_state()const { return m_state; }
-		virtual void tag_executed() = 0;
-
-	// Should not absolutely changed after creation, no point in making it protected
-	private:
-		Type m_type;
-		Order m_order;
-		u32   m_pass;
-
-	protected:
-		State m_state;
-	};
-
-	/*
-		Topic: RenderLayer
-			A RenderLayer is basically a collection of render queues + + pass ordering. It used to be templated with the keysize
-			as parameter, but right now we assume a 64-bit key and that's it, there is no reason to complicate
-			things even further and with 64 bit register there should be close to 0 overhead
-
-		Note:
-			Most of the renderlayer functionalities involves redirecting the calls to the underlying renderqueues,
-			a thing that can be done is making everything inline. There is no real need tho for now so it' left like 
-			this
-	*/
-	class RenderLayer final : public Layer
-	{
-	public:
-		/*
-			Constructor: RenderLayer
-				Creates a new RenderLayer instance with the specified pass and ordering. Note that pass is u32,
-
-				but in reality very few passes are used and remember that gaps *cannot* exist
-		*/
-		RenderLayer(Order order, u32 pass, u32 num_render_queues, u32 queue_size_estimate = 100);
-
-		/*
-			Destructor: ~RenderLayer
-				Destroys the current instance releasina all the resources, it does *not* unregister himself from the
-				layer dispatcher!
-		*/
-		~RenderLayer();
-
-		// Some copy constructors are currently deleted, but can be written, this is not done
-		// because it takes some time and there is no real need for it
-		RenderLayer(RenderLayer& other) = delete;
-		RenderLayer& operator=(RenderLayer& other) = delete;
-
-		RenderLayer(RenderLayer&& other) = default;
-		RenderLayer& operator=(RenderLayer&& other) = default;
-
-		void begin();
-
-		RenderItem* create_render_item(u32 render_queue);
-
-		void end(u32 render_queue, const ParameterGroup* shared_parameters = nullptr, Dependency* dependencies = nullptr, const u32 num_dependencies = 0);
-
-		const Queue<RenderItem>* get_render_queues()const { return m_render_queues; }
-		u32 get_num_render_queues()const { return m_num_render_queues; }
-
-		void tag_executed()override;
-
-	private:
-		Queue<RenderItem>* m_render_queues;
-		u32			 m_num_render_queues;
-	};
-
-	// Compute layer currently does not support multiple queues
-	class ComputeLayer final : public Layer
-	{
-	public:
-		ComputeLayer(Order order, u32 pass);
-		~ComputeLayer() = default;
-
-		void begin();
-
-		ComputeItem* create_compute_item();
-
-		void end();
-
-		
-		const Queue<ComputeItem>* get_queue()const;
-		void tag_executed()override;
-
-	private:
-		Queue<ComputeItem> m_queue;
-	};
-
-	/*
-		Class: PostProcessLayer
-			A postprocess layer is different than the other layers, since it does not beging and end,
-			but is filled once and can be reloaded, it's made of a bunch of compute items that have no 
-			key and are orderered based on the submission order. It should not be rebuilt every frame
-	*/
-	class PostProcessLayer final : public Layer
-	{
-	public:
-		PostProcessLayer(Order order, u32 pass);
-		~PostProcessLayer();
-		
-		// Note: items are copied, feel free to release the memory
-		void create(const PostProcessItem* items, u32 num_items);
-		void set_shared_parameters(const ParameterGroup& parameters);
-
-		const ParameterGroup* get_shared_parameters()const { return &m_shared_parameters; }
-
-		const PostProcessItem* get_items()const { return m_items; }
-		u32 get_num_items()const { return m_num_items; }
-		void tag_executed()override;
-
-	private:
-		PostProcessItem* m_items;
-		u32 m_num_items;
-		ParameterGroup m_shared_parameters;
-	};
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "common_structs.hpp"
+#include "queue.hpp"
+
+// C++ STL
+#include <vector>
+
+namespace camy
+{
+	// Forward declaration
+	class Context;
+
+	struct RenderItem;
+	struct ParameterGroup;
+
+	class Layer
+	{
+	public:
+		/*
+			Enum: Layer::Order
+			How this pass should be executed compared to the others. Only applies to layers that don't declare
+			the resources they access ( see reads() / writes() ), otherwise the order is derived from the declarations
+			and the pass is only used to resolve conflicting accesses.
+		*/
+		enum class Order
+		{
+			Ordered,	// Has a specific pass N and is executed before the pass N+1 and after the pass N-1
+			Unordered,	// Doesn't matter, can be executed whenever needed
+		};
+
+		/*
+			Struct: Layer::ResourceAccess
+				Resource read or written by a layer
+		*/
+		struct ResourceAccess
+		{
+			const PipelineResource* resource{ nullptr };
+			bool write{ false };
+		};
+
+		/*
+			Shall i use the same Queue::State ? 
+		*/
+		enum class State
+		{
+			Executed,
+			Queueing,
+			Ready,
+			Permanent // Exception for PostProcessLayer
+		};
+
+	public:
+		enum class Type
+		{
+			Render,
+			Compute,
+			PostProcess
+		};
+
+		Layer(Type type, Order order, u32 pass) : m_type{ type }, m_order{ order }, m_pass{ pass }, m_state{ State::Executed } { }
+		virtual ~Layer() = default;
+		
+		Type get_type()const { return m_type; }
+		Order get_order()const { return m_order; }
+		u32 get_pass()const { return m_pass; }
+		State get_state()const { return m_state; }
+		virtual void tag_executed() = 0;
+
+		/*
+			Function: reads
+				Declares that the layer reads resource. Declarations persist across frames until clear_resources()
+				is called
+		*/
+		void reads(const PipelineResource* resource);
+
+		/*
+			Function: writes
+				Declares that the layer writes resource ( render target, depth buffer, uav ), writes are assumed 
+				to preserve the previous content
+		*/
+		void writes(const PipelineResource* resource);
+
+		void clear_resources() { m_resources.clear(); }
+
+		const ResourceAccess* get_resources()const { return m_resources.empty() ? nullptr : &m_resources[0]; }
+		u32 get_num_resources()const { return static_cast<u32>(m_resources.size()); }
+		bool has_declared_resources()const { return !m_resources.empty(); }
+
+	// Should not absolutely changed after creation, no point in making it protected
+	private:
+		Type m_type;
+		Order m_order;
+		u32   m_pass;
+
+	protected:
+		State m_state;
+
+	private:
+		std::vector<ResourceAccess> m_resources;
+	};
+
+	/*
+		Topic: RenderLayer
+			A RenderLayer is basically a collection of render queues + + pass ordering. It used to be templated with the keysize
+			as parameter, but right now we assume a 64-bit key and that's it, there is no reason to complicate
+			things even further and with 64 bit register there should be close to 0 overhead
+
+		Note:
+			Most of the renderlayer functionalities involves redirecting the calls to the underlying renderqueues,
+			a thing that can be done is making everything inline. There is no real need tho for now so it' left like 
+			this
+	*/
+	class RenderLayer final : public Layer
+	{
+	public:
+		/*
+			Class: Recorder
+				Records render items from a worker thread, see Queue::Recorder. Each thread should use its own
+				thread index, all the recorders have to be done before end() is called on the render queues
+		*/
+		class Recorder final
+		{
+		public:
+			Recorder() : m_layer{ nullptr }, m_thread_index{ 0 } { }
+
+			RenderItem* create_render_item(u32 render_queue, RenderItem::Key key = 0);
+			void set_render_item_key(u32 render_queue, RenderItem* render_item, RenderItem::Key key);
+
+			bool is_valid()const { return m_layer != nullptr; }
+
+		private:
+			friend class RenderLayer;
+			Recorder(RenderLayer* layer, u32 thread_index) : m_layer{ layer }, m_thread_index{ thread_index } { }
+
+			RenderLayer* m_layer;
+			u32			 m_thread_index;
+		};
+
+		/*
+			Constructor: RenderLayer
+				Creates a new RenderLayer instance with the specified pass and ordering. Note that pass is u32,
+
+				but in reality very few passes are used and remember that gaps *cannot* exist
+		*/
+		RenderLayer(Order order, u32 pass, u32 num_render_queues, u32 queue_size_estimate = 100);
+
+		/*
+			Destructor: ~RenderLayer
+				Destroys the current instance releasina all the resources, it does *not* unregister himself from the
+				layer dispatcher!
+		*/
+		~RenderLayer();
+
+		// Some copy constructors are currently deleted, but can be written, this is not done
+		// because it takes some time and there is no real need for it
+		RenderLayer(RenderLayer& other) = delete;
+		RenderLayer& operator=(RenderLayer& other) = delete;
+
+		RenderLayer(RenderLayer&& other) = default;
+		RenderLayer& operator=(RenderLayer&& other) = default;
+
+		void begin();
+
+		/*
+			Function: create_render_item
+				Creates a new item in the specified render queue. The key should be passed here ( or later
+				via set_render_item_key ), writing RenderItem::key directly is not seen by the sort
+		*/
+		RenderItem* create_render_item(u32 render_queue, RenderItem::Key key = 0);
+
+		void set_render_item_key(u32 render_queue, RenderItem* render_item, RenderItem::Key key);
+
+		/*
+			Function: create_recorder
+				Returns a recorder for the specified thread, thread_index has to be < Queue<RenderItem>::max_recorders
+		*/
+		Recorder create_recorder(u32 thread_index);
+
+		/*
+			Function: set_reorder_items
+				See Queue::set_reorder_items, applies to all the render queues
+		*/
+		void set_reorder_items(bool reorder_items);
+
+		/*
+			Function: set_retained
+				See Queue::set_retained, applies to all the render queues. Retained items are 
+				managed through the handle based functions below
+		*/
+		void set_retained(bool retained);
+
+		/*
+			Function: set_max_items
+				See Queue::set_max_items, applies to all the render queues
+		*/
+		void set_max_items(u32 max_items);
+
+		/*
+			Function: set_instancing
+				Enables automatic instancing for all the render queues, instance_data_size is the size of
+				RenderItem::instance_data. Consecutive ( in sorted order ) items that differ only by their instance data 
+				are drawn with a single instanced draw call, items that can't be merged are drawn as single instances.
+				The vertex shaders are expected to read the instance data as vertex inputs ( see features::instance_semantic ).
+				0 disables instancing
+		*/
+		void set_instancing(u32 instance_data_size) { m_instance_data_size = instance_data_size; }
+		u32 get_instance_data_size()const { return m_instance_data_size; }
+
+		using ItemHandle = Queue<RenderItem>::Handle;
+
+		ItemHandle add_render_item(u32 render_queue, RenderItem::Key key = 0);
+		RenderItem* get_render_item(u32 render_queue, ItemHandle handle);
+		void set_render_item_key(u32 render_queue, ItemHandle handle, RenderItem::Key key);
+		void remove_render_item(u32 render_queue, ItemHandle handle);
+
+		void end(u32 render_queue, const ParameterGroup* shared_parameters = nullptr, Dependency* dependencies = nullptr, const u32 num_dependencies = 0);
+
+		const Queue<RenderItem>* get_render_queues()const { return m_render_queues; }
+		u32 get_num_render_queues()const { return m_num_render_queues; }
+
+		void tag_executed()override;
+
+	private:
+		Queue<RenderItem>* m_render_queues;
+		u32			 m_num_render_queues;
+		u32			 m_instance_data_size;
+	};
+
+	// Compute layer currently does not support multiple queues
+	class ComputeLayer final : public Layer
+	{
+	public:
+		ComputeLayer(Order order, u32 pass);
+		~ComputeLayer() = default;
+
+		void begin();
+
+		ComputeItem* create_compute_item(ComputeItem::Key key = 0);
+
+		void end();
+
+		/*
+			Function: set_max_items
+				See Queue::set_max_items
+		*/
+		void set_max_items(u32 max_items) { m_queue.set_max_items(max_items); }
+		
+		const Queue<ComputeItem>* get_queue()const;
+		void tag_executed()override;
+
+	private:
+		Queue<ComputeItem> m_queue;
+	};
+
+	/*
+		Class: PostProcessLayer
+			A postprocess layer is different than the other layers, since it does not beging and end,
+			but is filled once and can be reloaded, it's made of a bunch of compute items that have no 
+			key and are orderered based on the submission order. It should not be rebuilt every frame
+	*/
+	class PostProcessLayer final : public Layer
+	{
+	public:
+		PostProcessLayer(Order order, u32 pass);
+		~PostProcessLayer();
+		
+		// Note: items are copied, feel free to release the memory
+		void create(const PostProcessItem* items, u32 num_items);
+		void set_shared_parameters(const ParameterGroup& parameters);
+
+		const ParameterGroup* get_shared_parameters()const { return &m_shared_parameters; }
+
+		const PostProcessItem* get_items()const { return m_items; }
+		u32 get_num_items()const { return m_num_items; }
+		void tag_executed()override;
+
+	private:
+		PostProcessItem* m_items;
+		u32 m_num_items;
+		ParameterGroup m_shared_parameters;
+	};
 }
\ No newline at end of file
@@ -1,56 +1,130 @@
-#pragma once
-
-// camy
-#include "resources.hpp"
-#include "shader.hpp"
-#include "common_structs.hpp"
-
-namespace camy
-{
-	enum PipelineStates
-	{
-		PipelineStates_None = 0,
-		PipelineStates_CommonStates = 1 << 0,
-		PipelineStates_VertexShader = 1 << 1,
-		PipelineStates_GeometryShader = 1 << 2,
-		PipelineStates_PixelShader = 1 << 3,
-		PipelineStates_VertexBuffer1 = 1 << 4,
-		PipelineStates_VertexBuffer2 = 1 << 5,
-		PipelineStates_IndexBuffer = 1 << 6,
-		PipelineStates_PrimitiveTopology = 1 << 7,
-	};
-
-	/*
-		As described in GPUBackend::execute() this is the current method, when working
-		with stategroups the whole caching system would be slightly different.
-	*/
-	struct PipelineCache
-	{
-		PipelineCache();
-		
-		// Common pipeline states
-		CommonStates* common_states{ nullptr };
-
-		// Cache for shaders
-		const ParameterGroup*   parameter_cache[features::num_cache_slots];
-		CachedConstantBuffer*	cbuffer_cache[features::max_bindable_constant_buffers];
-
-		// Common states
-		VertexBuffer*		vertex_buffer1{ nullptr };
-		VertexBuffer*		vertex_buffer2{ nullptr };
-		IndexBuffer*		index_buffer{ nullptr };
-		PrimitiveTopology	primitive_topology{ PrimitiveTopology::TriangleList };
-		Shader*				shaders[Shader::num_types];
-
-		// Used to check whether nullptrs refer to actual null states or not yet set
-		u32 states_set{ PipelineStates_None };
-	};
-
-	inline PipelineCache::PipelineCache()
-	{
-		// Setting arrays to null
-		std::memset(parameter_cache, 0, sizeof(ParameterGroup*) * features::num_cache_slots);
-		std::memset(cbuffer_cache, 0, sizeof(CachedConstantBuffer*) * features::max_bindable_constant_buffers);
-		std::memset(shaders, 0, sizeof(Shader*) * Shader::num_types);
-	}
-}
\ No newline at end of file
+#pragma once
+
+// camy
+#include "resources.hpp"
+#include "shader.hpp"
+#include "common_structs.hpp"
+#include "features.hpp"
+
+namespace camy
+{
+	enum PipelineStates
+	{
+		PipelineStates_None = 0,
+		PipelineStates_CommonStates = 1 << 0,
+		PipelineStates_VertexShader = 1 << 1,
+		PipelineStates_GeometryShader = 1 << 2,
+		PipelineStates_PixelShader = 1 << 3,
+		PipelineStates_VertexBuffer1 = 1 << 4,
+		PipelineStates_VertexBuffer2 = 1 << 5,
+		PipelineStates_IndexBuffer = 1 << 6,
+		PipelineStates_PrimitiveTopology = 1 << 7,
+		PipelineStates_ComputeShader = 1 << 8,
+	};
+
+	/*
+		Class: PipelineCache
+			Shadow of what is bound to the device context, owned by the GPUBackend and kept for its whole
+			lifetime: across streams, layers and frames. Every bind goes through it, set_* functions record
+			the new state and return false if the context already has it, the API call is then skipped.
+			Ranges are trimmed to the slots that actually changed.
+			CommandStream already strips the redundant binds inside a stream, what is left here are the ones
+			redundant with what the previous stream left ( e.g. post process items and layers sharing states ).
+			Objects are the API ones ( shaders, views, states ) compared by address, the context keeps a
+			reference to them while bound, thus an address can't be reused by a new object meanwhile.
+			Starts as a cleared context ( everything null, no topology nor viewport ), reset() has to be called
+			whenever the context state is cleared or changed without going through it.
+	*/
+	class PipelineCache final
+	{
+	public:
+		/*
+			Struct: Stats
+				API calls issued and skipped since the last reset_stats(), a trimmed range counts as issued
+		*/
+		struct Stats
+		{
+			u64 num_issued_binds{ 0 };
+			u64 num_skipped_binds{ 0 };
+		};
+
+		PipelineCache();
+		~PipelineCache() = default;
+
+		// Input assembler
+		bool set_input_layout(const void* input_layout);
+		bool set_vertex_buffer(u32 slot, const void* buffer, u32 stride, u32 offset);
+		bool set_index_buffer(const void* buffer, u32 format);
+		bool set_primitive_topology(u32 primitive_topology);
+
+		bool set_shader(Shader::Type type, const void* shader);
+
+		/*
+			Function: set_samplers
+				Range of first_slot, num_slots objects, trimmed to the changed slots if any. The caller
+				binds objects + ( trimmed first_slot - first_slot ). Same for the other ranges
+		*/
+		bool set_samplers(Shader::Type type, u32& first_slot, u32& num_slots, const void* const* samplers);
+		bool set_shader_resources(Shader::Type type, u32& first_slot, u32& num_slots, const void* const* views);
+		bool set_unordered_access_views(u32& first_slot, u32& num_slots, const void* const* views);
+
+		// Offset and size are in constants, 0 for the whole buffer
+		bool set_constant_buffer(Shader::Type type, u32 slot, const void* buffer, u32 first_constant = 0, u32 num_constants = 0);
+
+		// Rasterizer, depth is always [0, 1]
+		bool set_viewport(float left, float top, float width, float height);
+		bool set_rasterizer_state(const void* rasterizer_state);
+
+		// Output merger, features::max_cachable_rts render targets
+		bool set_outputs(const void* const* render_targets, const void* depth_buffer);
+		bool set_blend_state(const void* blend_state);
+		bool set_depth_stencil_state(const void* depth_stencil_state);
+
+		void reset();
+
+		const Stats& get_stats()const { return m_stats; }
+		void reset_stats() { m_stats = Stats(); }
+
+	private:
+		struct VertexBufferBinding
+		{
+			const void* buffer;
+			u32			stride;
+			u32			offset;
+		};
+
+		struct ConstantBufferBinding
+		{
+			const void* buffer;
+			u32			first_constant;
+			u32			num_constants;
+		};
+
+		// Counts the call and returns whether it has to be issued
+		bool _bind(bool changed);
+		bool _set_range(const void** bound, u32 max_slots, u32& first_slot, u32& num_slots, const void* const* objects);
+
+	private:
+		const void*			m_input_layout;
+		VertexBufferBinding m_vertex_buffers[features::max_bindable_vertex_buffers];
+		const void*			m_index_buffer;
+		u32					m_index_format;
+		u32					m_primitive_topology;
+
+		const void*			  m_shaders[Shader::num_types];
+		const void*			  m_samplers[Shader::num_types][features::max_bindable_samplers];
+		const void*			  m_shader_resources[Shader::num_types][features::max_bindable_shader_resources];
+		const void*			  m_unordered_access_views[features::max_bindable_shader_resources];
+		ConstantBufferBinding m_constant_buffers[Shader::num_types][features::max_bindable_constant_buffers];
+
+		float		m_viewport[4];
+		const void* m_rasterizer_state;
+
+		const void* m_render_targets[features::max_cachable_rts];
+		const void* m_depth_buffer;
+		const void* m_blend_state;
+		const void* m_depth_stencil_state;
+
+		Stats m_stats;
+	};
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "common_structs.hpp"
+#include "pipeline_cache.hpp"
+
+// C++ STL
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace camy
+{
+	/*
+		Enum: CommonStatesParts
+			Parts of CommonStates that are set independently on the device
+	*/
+	enum CommonStatesParts
+	{
+		CommonStatesParts_None = 0,
+		CommonStatesParts_Outputs = 1 << 0, // Render targets & depth buffer
+		CommonStatesParts_Viewport = 1 << 1,
+		CommonStatesParts_BlendState = 1 << 2,
+		CommonStatesParts_RasterizerState = 1 << 3,
+		CommonStatesParts_DepthStencilState = 1 << 4,
+		CommonStatesParts_All = (1 << 5) - 1
+	};
+
+	/*
+		Function: diff_common_states
+			Mask of CommonStatesParts that differ between the two
+	*/
+	u32 diff_common_states(const CommonStates& a, const CommonStates& b);
+
+	/*
+		Class: PipelineState
+			Immutable bundle of the states a RenderItem would otherwise set one by one: shaders ( and thus the
+			input signature ), common states and topology. Pipeline states are hash-consed by the PipelineStateCache,
+			equal descriptions map to the same object, thus two items have the same states if and only if they have
+			the same id.
+			The id packs the ids of the single states, which means the states that differ between two pipeline states
+			are found with a xor of their ids ( see diff() ), without touching the descriptions.
+			Common states are compared by value, shaders by address.
+	*/
+	class PipelineState final
+	{
+	public:
+		using Id = u64;
+
+		struct Description
+		{
+			const Shader*	  vertex_shader{ nullptr };
+			const Shader*	  geometry_shader{ nullptr };
+			const Shader*	  pixel_shader{ nullptr };
+			CommonStates	  common_states;
+			PrimitiveTopology primitive_topology{ PrimitiveTopology::TriangleList };
+		};
+
+		// Bits of the id reserved to each state, unique common states and shaders are limited by them
+		static const u32 common_states_bits{ 20 };
+		static const u32 shader_bits{ 13 };
+		static const u32 topology_bits{ 3 };
+
+		static const u32 common_states_shift{ 0 };
+		static const u32 vertex_shader_shift{ common_states_shift + common_states_bits };
+		static const u32 geometry_shader_shift{ vertex_shader_shift + shader_bits };
+		static const u32 pixel_shader_shift{ geometry_shader_shift + shader_bits };
+		static const u32 topology_shift{ pixel_shader_shift + shader_bits };
+		static_assert(topology_shift + topology_bits <= 64, "PipelineState::Id is too small for the state ids");
+
+		/*
+			Function: diff
+				PipelineStates flags of the states that differ between a and b
+		*/
+		static u32 diff(Id a, Id b);
+
+		Id get_id()const { return m_id; }
+		const Description& get_description()const { return m_description; }
+
+	private:
+		friend class PipelineStateCache;
+
+		PipelineState(Id id, const Description& description) : m_id{ id }, m_description(description) { }
+
+		Id			m_id;
+		Description m_description;
+	};
+
+	/*
+		Class: PipelineStateCache
+			Creates and owns the pipeline states ( see GPUBackend::create_pipeline_state ), states are never released
+			before the cache is cleared. Creation is thread safe, it's not meant for the hot path: items are expected
+			to reference states created at load time.
+	*/
+	class PipelineStateCache final
+	{
+	public:
+		PipelineStateCache() = default;
+		~PipelineStateCache() = default;
+
+		PipelineStateCache(const PipelineStateCache& other) = delete;
+		PipelineStateCache& operator=(const PipelineStateCache& other) = delete;
+
+		/*
+			Function: get
+				Returns the pipeline state for the description, creating it the first time. nullptr if the
+				unique states exceed the bits reserved in the id
+		*/
+		const PipelineState* get(const PipelineState::Description& description);
+
+		void clear();
+
+		u32 get_num_pipeline_states()const;
+
+	private:
+		u32 _common_states_id(const CommonStates& common_states);
+		u32 _shader_id(const Shader* shader);
+
+	private:
+		mutable std::mutex m_mutex;
+
+		// Common states bucketed by hash, ids are indices + 1
+		std::vector<CommonStates> m_common_states;
+		std::unordered_multimap<u32, u32> m_common_states_ids;
+
+		// 0 is reserved to null
+		std::unordered_map<const Shader*, u32> m_shader_ids;
+
+		std::unordered_map<PipelineState::Id, PipelineState> m_pipeline_states;
+	};
+}
@@ -1,130 +1,358 @@
-#pragma once
-
-// camy
-#include <camy/base.hpp>
-#include <camy/common_structs.hpp>
-
-// C++ STL
-#include <vector>
-
-namespace camy
-{
-	// Forward declarations
-	struct ParameterGroup;
-
-	/*
-		Class: Queue
-			This is a Queue, multiple render queues make up a layers, an example would be :
-				Forward layer made of :
-					opaque queue
-					transparent queue
-	*/
-	template <typename ItemType>
-	class Queue final
-	{
-	public:
-		enum class State
-		{
-			Executed,
-			Queueing,
-			Ready
-		};
-
-	public:
-		Queue();
-		~Queue() = default;
-
-		// Copying is ok, but dont see where it could be called ( inside containers ? )
-		Queue(const Queue& other) = default;
-		Queue& operator=(const Queue& other) = default;
-
-		/*
-			Function: begin
-				Prepares before queueing items, to be called before calling queue() it's needed to reset internal buffer,
-				undefined behavior otherwise
-		*/
-		void begin();
-
-		ItemType* create_item();
-
-		/*
-			Function: end
-				Sorts and does last minute things before actual rendering, once end is called() any subsequent call to
-				LayerDispatcher::dispatch() might eventually render the layer depending on ordering
-		*/
-		void end(const ParameterGroup* shared_parameters = nullptr, Dependency* dependencies = nullptr, const u32 num_dependencies = 0);
-	
-		/*
-			Function: get_shared_parameters
-				Returns the shared parameters by all the items in the Queue
-		*/
-		const ParameterGroup& get_shared_parameters()const { static const ParameterGroup default_shared_parameters; return m_shared_parameters == nullptr ? default_shared_parameters : *m_shared_parameters; }
-
-		/*
-			Function: get_dependencies
-				Returns the buffer of dependencies that need to be taken care of after rendering all the items,
-
-				Note: This is done at the, after rendering!
-		*/
-		const Dependency* get_dependencies()const { return m_dependencies; }
-
-		/*
-			Function: get_num_dependencies
-				Returns the number of the dependencies in the get_dependencies() buffer
-		*/
-		u32 get_num_dependencies()const { return m_num_dependencies; }
-
-		/*
-			Function: get_render_items
-				Returns a pointer to the buffer of render items, call get_num_render_items() to see the loop
-				boundaries.
-		*/
-		const ItemType* get_items()const;
-
-		/*
-			Function: get_num_render_items
-				Returns the number of items that are in queue, this will return 0 until is_ready() is true
-		*/
-		u32 get_num_items()const;
-
-		/*
-			Function: get_sorted_indices
-				Returns the sorted index buffer
-		*/
-		const u32* get_sorted_indices()const;
-
-		/*
-			Function: get_num_sorted_indices
-				Returns the length of the index buffer, this is the same as num_render_items
-		*/
-		u32 get_num_sorted_indices()const;
-
-		/*
-			Function: get_state
-				Returns the current state of the queue
-		*/
-		State get_state()const { return m_state; }
-
-		/*
-			Function: tag_executed
-				Once the items in the queue have been processed tag_executed will
-				reset the internal state and allow a begin()
-		*/
-		void tag_executed();
-
-	private:
-		// Currently 
-		std::vector<ItemType> m_render_items;
-
-		// Not even remotely handling the > 2^32 items queued
-		std::vector<u32> m_sorted_indices;
-
-		ParameterGroup const*   m_shared_parameters;
-		Dependency*		m_dependencies;
-		u32				m_num_dependencies;
-
-		State m_state;
-	};
-}
-
+#pragma once
+
+// camy
+#include <camy/base.hpp>
+#include <camy/common_structs.hpp>
+#include <camy/features.hpp>
+#include <camy/allocators/reserved_vector.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace camy
+{
+	// Forward declarations
+	struct ParameterGroup;
+
+	/*
+		Class: Queue
+			This is a Queue, multiple render queues make up a layers, an example would be :
+				Forward layer made of :
+					opaque queue
+					transparent queue
+	*/
+	template <typename ItemType>
+	class Queue final
+	{
+	public:
+		enum class State
+		{
+			Executed,
+			Queueing,
+			Ready
+		};
+
+		/*
+			Enum: SortMethod
+				Algorithm that has been used the last time end() has been called, the choice
+				is made every frame based on how far from sorted the previous order is
+		*/
+		enum class SortMethod
+		{
+			None,		// Already sorted ( or less than two items ), nothing has been moved
+			Insertion,	// Temporal coherence, previous order was almost sorted
+			Radix		// LSD radix sort over the key bytes, order was far from sorted
+		};
+
+		/*
+			Below this number of items insertion sort is always used, radix has a fixed cost
+			( histograms + prefix sums ) that is not worth paying
+		*/
+		static const u32 radix_sort_min_items{ 256 };
+
+		/*
+			If more than 1 every radix_sort_disorder_ratio items is out of place with respect to
+			the previous frame order, the coherence is considered lost and radix sort is used
+		*/
+		static const u32 radix_sort_disorder_ratio{ 64 };
+
+		/*
+			Descents only bound the work from below, a single item displaced far ( or many new items with
+			low keys appended ) costs O(n) moves. Insertion sort gives up after radix_sort_max_moves_ratio 
+			moves per item and radix sort finishes the job, the total stays linear
+		*/
+		static const u32 radix_sort_max_moves_ratio{ 8 };
+
+		using Key = typename ItemType::Key;
+
+		/*
+			Struct: SortEntry
+				Compact ( key, item index ) pair, sorting is done exclusively on a dense array of these
+				instead of gathering keys from the items, that are way bigger and scattered all over the queue
+		*/
+		struct SortEntry
+		{
+			Key key;
+			u32 index;
+		};
+
+		/*
+			Stable reference to an item of a retained queue, see set_retained()
+		*/
+		using Handle = u32;
+		static const Handle invalid_handle{ 0xFFFFFFFF };
+
+		/*
+			Maximum number of threads that can record into the same queue at the same time
+		*/
+		static const u32 max_recorders{ 16 };
+
+		/*
+			Class: Recorder
+				Lightweight handle that records items into the per-thread segment of a queue. Different recorders
+				can be used concurrently from different threads, a single recorder must be used by one thread at a time.
+				Items created through a recorder are merged into the queue by end(), after that the pointers 
+				returned by create_item() are not valid anymore ( until then they are stable ). end() has to be called once all the recording threads are done
+		*/
+		class Recorder final
+		{
+		public:
+			Recorder();
+
+			ItemType* create_item(Key key = 0);
+			void set_key(ItemType* item, Key key);
+
+			bool is_valid()const { return m_queue != nullptr; }
+			u32 get_index()const { return m_index; }
+
+		private:
+			friend class Queue;
+			Recorder(Queue* queue, u32 index);
+
+			Queue* m_queue;
+			u32	   m_index;
+		};
+
+	public:
+		Queue();
+		~Queue() = default;
+
+		// Copying is ok, but dont see where it could be called ( inside containers ? )
+		Queue(const Queue& other) = default;
+		Queue& operator=(const Queue& other) = default;
+
+		/*
+			Function: begin
+				Prepares before queueing items, to be called before calling queue() it's needed to reset internal buffer,
+				undefined behavior otherwise
+		*/
+		void begin();
+
+		/*
+			Function: create_item
+				Creates a new item with the specified sort key, the key is written in the item and in the dense 
+				key array used when sorting. Writing item->key directly afterwards has no effect on sorting, use set_key().
+				Items are stored contiguously and never move while queueing, nullptr is returned if features::max_queue_items
+				has been reached
+		*/
+		ItemType* create_item(Key key = 0);
+
+		/*
+			Function: set_key
+				Changes the sort key of an item previously created with create_item() in the current begin()/end() block
+		*/
+		void set_key(ItemType* item, Key key);
+
+		/*
+			Function: set_retained
+				In retained mode items are not cleared by begin(), they are added once with add_item() and persist 
+				across frames until remove_item() is called. Items are patched through get_item() and keys changed
+				via set_key(handle), if nothing has been added, removed or changed key end() doesn't sort at all.
+				create_item(), recorders and item reordering are not available. Switching mode discards all the items
+				and can be done only once the queue has been executed
+		*/
+		void set_retained(bool enabled);
+		bool is_retained()const { return m_retained; }
+
+		/*
+			Function: set_max_items
+				Items the queue and each of its recorders can hold, features::max_queue_items by default. Address
+				space is reserved for all of them ( see ReservedVector ), queues known to stay small should lower it.
+				Discards all the items as set_retained() does, can be done only once the queue has been executed
+		*/
+		void set_max_items(u32 max_items);
+		u32 get_max_items()const { return m_render_items.max_size(); }
+
+		/*
+			Function: add_item
+				Adds a persistent item to a retained queue, the handle stays valid until remove_item()
+		*/
+		Handle add_item(Key key = 0);
+
+		/*
+			Function: get_item
+				Returns the retained item for patching, the pointer is valid until the next add_item()
+		*/
+		ItemType* get_item(Handle handle);
+
+		/*
+			Function: set_key
+				Changes the key of a retained item, setting the same key does not trigger a sort
+		*/
+		void set_key(Handle handle, Key key);
+
+		/*
+			Function: remove_item
+				Removes a retained item, the handle might be returned again by add_item()
+		*/
+		void remove_item(Handle handle);
+
+		/*
+			Function: get_num_retained_items
+				Returns the number of live items in a retained queue
+		*/
+		u32 get_num_retained_items()const;
+
+		/*
+			Function: create_recorder
+				Returns the recorder associated with the specified thread index, it is always the same segment, 
+				different threads should use different indices. Can be called at any time, the recorder can be used
+				only between begin() and end()
+		*/
+		Recorder create_recorder(u32 thread_index);
+
+		/*
+			Function: set_reorder_items
+				If enabled, once sorted the items are physically moved in sorted order, this way they can be walked
+				linearly when executing at the cost of a copy. Pointers returned by create_item() are invalidated by end()
+		*/
+		void set_reorder_items(bool enabled) { m_reorder_items = enabled; }
+		bool is_reorder_items_enabled()const { return m_reorder_items; }
+
+		/*
+			Function: end
+				Sorts and does last minute things before actual rendering, once end is called() any subsequent call to
+				LayerDispatcher::dispatch() might eventually render the layer depending on ordering.
+				Items recorded through Recorders are merged after the ones created directly, in recorder index order.
+				Items are sorted by ascending key, equal keys keep the order they had the previous frame
+		*/
+		void end(const ParameterGroup* shared_parameters = nullptr, Dependency* dependencies = nullptr, const u32 num_dependencies = 0);
+	
+		/*
+			Function: get_shared_parameters
+				Returns the shared parameters by all the items in the Queue
+		*/
+		const ParameterGroup& get_shared_parameters()const { static const ParameterGroup default_shared_parameters; return m_shared_parameters == nullptr ? default_shared_parameters : *m_shared_parameters; }
+
+		/*
+			Function: get_dependencies
+				Returns the buffer of dependencies that need to be taken care of after rendering all the items,
+
+				Note: This is done at the, after rendering!
+		*/
+		const Dependency* get_dependencies()const { return m_dependencies; }
+
+		/*
+			Function: get_num_dependencies
+				Returns the number of the dependencies in the get_dependencies() buffer
+		*/
+		u32 get_num_dependencies()const { return m_num_dependencies; }
+
+		/*
+			Function: get_render_items
+				Returns a pointer to the buffer of render items, call get_num_render_items() to see the loop
+				boundaries.
+		*/
+		const ItemType* get_items()const;
+
+		/*
+			Function: get_num_render_items
+				Returns the number of items that are in queue, this will return 0 until is_ready() is true
+		*/
+		u32 get_num_items()const;
+
+		/*
+			Function: get_sort_entries
+				Returns the sorted ( key, index ) buffer, index refers to get_items(). If items have been physically 
+				reordered ( see set_reorder_items ) null is returned and get_items() is already in sorted order
+		*/
+		const SortEntry* get_sort_entries()const;
+
+		/*
+			Function: get_num_sort_entries
+				Returns the number of items to execute, this is the length of the sort entry buffer. In retained queues
+				it can be less than get_num_items() since removed items leave holes
+		*/
+		u32 get_num_sort_entries()const;
+
+		/*
+			Function: get_state
+				Returns the current state of the queue
+		*/
+		State get_state()const { return m_state; }
+
+		/*
+			Function: get_sort_method
+				Returns the algorithm used to sort the items the last time end() has been called, Radix
+				if insertion sort ran out of moves and radix sort completed it
+		*/
+		SortMethod get_sort_method()const { return m_sort_method; }
+
+		/*
+			Function: get_sort_disorder
+				Returns the number of items that were found out of place ( descents ) in the previous
+				frame order the last time end() has been called. Useful to tune radix_sort_disorder_ratio
+		*/
+		u32 get_sort_disorder()const { return m_sort_disorder; }
+
+		/*
+			Function: tag_executed
+				Once the items in the queue have been processed tag_executed will
+				reset the internal state and allow a begin()
+		*/
+		void tag_executed();
+
+	private:
+		void _merge_segments();
+		void _update_entries();
+		void _update_retained_entries();
+		u32  _measure_disorder()const;
+		bool _insertion_sort(u64 max_moves);
+		void _radix_sort();
+
+		/*
+			Struct: RecordSegment
+				Items recorded by a single thread, the vectors headers are the only thing written by
+				more than one thread ( each to his own ) hence the padding. Address space is reserved only
+				by the recorders that are actually used
+		*/
+		struct RecordSegment
+		{
+			allocators::ReservedVector<ItemType> items{ features::max_queue_items };
+			std::vector<Key>	  keys;
+
+			Byte padding[camy_cache_line_size];
+		};
+
+	private:
+		// Reserved once, growing never copies the items nor invalidates the pointers given out
+		allocators::ReservedVector<ItemType> m_render_items;
+
+		RecordSegment m_segments[max_recorders];
+
+		// Keys in creation order, written by create_item() / set_key()
+		std::vector<Key> m_keys;
+
+		// Not even remotely handling the > 2^32 items queued. Entries are kept from the
+		// previous frame, this is where temporal coherence comes from
+		std::vector<SortEntry> m_sort_entries;
+
+		// Ping-pong buffer for the radix sort, kept around to avoid reallocating every frame
+		std::vector<SortEntry> m_sort_scratch;
+
+		// Destination of the physical reordering, swapped with m_render_items
+		allocators::ReservedVector<ItemType> m_reorder_scratch;
+		bool m_reorder_items;
+
+		// Retained mode, m_render_items is indexed by handle and has holes
+		bool m_retained;
+		bool m_retained_dirty;
+		std::vector<u8>		m_alive;
+		std::vector<u8>		m_in_sort_entries;
+		std::vector<Handle> m_free_slots;
+		std::vector<Handle> m_added_slots; // Since last end()
+
+		SortMethod m_sort_method;
+		u32		   m_sort_disorder;
+
+		ParameterGroup const*   m_shared_parameters;
+		Dependency*		m_dependencies;
+		u32				m_num_dependencies;
+
+		State m_state;
+	};
+}
+
 #include "queue.inl"
\ No newline at end of file
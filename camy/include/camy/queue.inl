@@ -1,186 +1,648 @@
-namespace camy
-{
-	template <typename ItemType>
-	Queue<ItemType>::Queue() :
-		m_shared_parameters{ nullptr },
-		m_dependencies{ nullptr },
-		m_num_dependencies{ 0 },
-		m_state{ State::Executed }
-	{
-
-	}
-
-	template <typename ItemType>
-	void Queue<ItemType>::begin()
-	{
-		if (m_state == State::Ready)
-		{
-			camy_warning("Can't call begin() before tag_executed has been called");
-			return;
-		}
-
-		if (m_state == State::Queueing)
-		{
-			camy_warning("Can't call begin multiple times");
-			return;
-		}
-
-		// Clearing the queue
-		m_render_items.clear();
-
-		m_shared_parameters = nullptr;
-		m_dependencies = nullptr;
-		m_num_dependencies = 0;
-	
-		// Ready for queueing
-		m_state = State::Queueing;
-	}
-
-	template <typename ItemType>
-	ItemType* Queue<ItemType>::create_item()
-	{
-		if (m_state != State::Queueing)
-		{
-			camy_warning("Can't create item before begin has been called");
-			return nullptr;
-		}
-
-		m_render_items.emplace_back();
-		return &m_render_items.back();
-	}
-	
-	template <typename ItemType>
-	void Queue<ItemType>::end(const ParameterGroup* shared_parameters, Dependency* dependencies, const u32 num_dependencies)
-	{
-		if (m_state == State::Executed)
-		{
-			camy_warning("Can't call end() before a begin has been called");
-			return;
-		}
-
-		if (m_state == State::Ready)
-		{
-			camy_warning("Can't call end() multiple times");
-			return;
-		}
-
-		m_shared_parameters = shared_parameters;
-
-		m_dependencies = dependencies;
-		m_num_dependencies = num_dependencies;
-
-		/*
-			Temporal coherence :
-			http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/
-			thanks L. Spiro
-		*/
-		auto current_size{ m_sorted_indices.size() };
-		auto next_size{ m_render_items.size() };
-
-		if (next_size > current_size)
-		{
-			// Adding last indices to the end of the queue
-			for (auto i{ current_size }; i < next_size; ++i)
-				m_sorted_indices.push_back(static_cast<u32>(i));
-		}
-
-		// We need to reset the indices
-		if (next_size < current_size)
-		{
-			m_sorted_indices.resize(next_size); // Resetting to new size
-			for (auto i{ 0u }; i < next_size; ++i)
-				m_sorted_indices[i] = static_cast<u32>(i);
-		}
-
-		// If size is the same we don't do anything, time to sort.
-		// We use insertion sort to make full use of probably already kind of sorted queue
-		// When resetting the indices a classic qsort might be more efficient //? Todo : Verify last statement
-		// Does it matter if i sort from left to right ? cache ? 
-		for (auto i{ 1u }; i < next_size; ++i)
-		{
-			auto j{ i };
-			ItemType::Key key_i{ m_render_items[m_sorted_indices[i]].key };
-
-			ItemType::Key key_jm1;
-			while (j > 0 && ((key_jm1 = m_render_items[m_sorted_indices[j - 1]].key) < key_i))
-			{
-				// Moving down & swapping j with j-1 ( could xor ) 
-				m_sorted_indices[j] = m_sorted_indices[j - 1];
-				--j;
-			}
-
-			// When we swap indices we also swap the pointers in the Queue, this way 
-			// looping the Queue is done in a decently cache friendly manner. Indices
-			// are still needed for temporal coherency
-			m_sorted_indices[j] = m_sorted_indices[i];
-		}
-
-		// Ready to be executed!
-		m_state = State::Ready;
-	}
-
-	template <typename ItemType>
-	const ItemType* Queue<ItemType>::get_items()const
-	{
-		if (m_state != State::Ready)
-		{
-			camy_error("Tried to retrieve render items before end() has been called, returning null");
-			return nullptr;
-		}
-
-		if (m_render_items.empty())
-			return nullptr;
-
-		return &m_render_items[0];
-	}
-
-	template <typename ItemType>
-	u32 Queue<ItemType>::get_num_items()const
-	{
-		if (m_state != State::Ready)
-		{
-			camy_error("Tried to retrieve number of render items before end() has been called, returning null");
-			return 0;
-		}
-
-		return static_cast<u32>(m_render_items.size());
-	}
-
-	template <typename ItemType>
-	const u32* Queue<ItemType>::get_sorted_indices()const
-	{
-		if (m_state != State::Ready)
-		{
-			camy_error("Tried to retrieve sorted indices before end() has been called, returning null");
-			return nullptr;
-		}
-
-		if (m_sorted_indices.empty())
-			return nullptr;
-
-		return &m_sorted_indices[0];
-	}
-
-	template <typename ItemType>
-	u32 Queue<ItemType>::get_num_sorted_indices()const
-	{
-		if (m_state != State::Ready)
-		{
-			camy_error("Tried to retrieve number of sorted indices before end() has been called, returning null");
-			return 0;
-		}
-
-		return static_cast<u32>(m_sorted_indices.size());
-	}
-
-	template <typename ItemType>
-	void Queue<ItemType>::tag_executed()
-	{
-		if (m_state == State::Executed)
-			camy_warning("Queue has been already tagged as executed executed!");
-		else if (m_state == State::Queueing)
-			camy_warning("Can't tag the queue as executed while queueing is till going on");
-		else // m_state == State::Ready
-			m_state = State::Executed;
-	}
+namespace camy
+{
+	template <typename ItemType>
+	Queue<ItemType>::Queue() :
+		m_render_items{ features::max_queue_items },
+		m_reorder_scratch{ features::max_queue_items },
+		m_reorder_items{ false },
+		m_retained{ false },
+		m_retained_dirty{ false },
+		m_shared_parameters{ nullptr },
+		m_dependencies{ nullptr },
+		m_num_dependencies{ 0 },
+		m_sort_method{ SortMethod::None },
+		m_sort_disorder{ 0 },
+		m_state{ State::Executed }
+	{
+
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::begin()
+	{
+		if (m_state == State::Ready)
+		{
+			camy_warning("Can't call begin() before tag_executed has been called");
+			return;
+		}
+
+		if (m_state == State::Queueing)
+		{
+			camy_warning("Can't call begin multiple times");
+			return;
+		}
+
+		// Clearing the queue, sort entries are kept for temporal coherence. Retained items
+		// persist until they are removed
+		if (!m_retained)
+		{
+			m_render_items.clear();
+			m_keys.clear();
+		}
+
+		for (auto& segment : m_segments)
+		{
+			segment.items.clear();
+			segment.keys.clear();
+		}
+
+		m_shared_parameters = nullptr;
+		m_dependencies = nullptr;
+		m_num_dependencies = 0;
+	
+		// Ready for queueing
+		m_state = State::Queueing;
+	}
+
+	template <typename ItemType>
+	ItemType* Queue<ItemType>::create_item(Key key)
+	{
+		if (m_state != State::Queueing)
+		{
+			camy_warning("Can't create item before begin has been called");
+			return nullptr;
+		}
+
+		if (m_retained)
+		{
+			camy_warning("Can't create transient items in a retained queue, use add_item()");
+			return nullptr;
+		}
+
+		auto item{ m_render_items.emplace_back() };
+		if (item == nullptr)
+			return nullptr;
+
+		item->key = key;
+		m_keys.push_back(key);
+
+		return item;
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::set_key(ItemType* item, Key key)
+	{
+		if (m_state != State::Queueing)
+		{
+			camy_warning("Can't set key outside of a begin() / end() block");
+			return;
+		}
+
+		camy_assert(!m_render_items.empty() && item >= &m_render_items.front() && item <= &m_render_items.back(), { return; }, "Item has not been created by this queue");
+
+		item->key = key;
+		m_keys[static_cast<u32>(item - &m_render_items[0])] = key;
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::set_retained(bool enabled)
+	{
+		if (m_state != State::Executed)
+		{
+			camy_warning("Can't change queue mode while items are being queued or waiting to be executed");
+			return;
+		}
+
+		if (enabled == m_retained)
+			return;
+
+		// Starting from scratch, handles are not valid anymore
+		m_render_items.clear();
+		m_keys.clear();
+		m_sort_entries.clear();
+		m_in_sort_entries.clear();
+		m_alive.clear();
+		m_free_slots.clear();
+		m_added_slots.clear();
+
+		m_retained = enabled;
+		m_retained_dirty = enabled;
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::set_max_items(u32 max_items)
+	{
+		if (m_state != State::Executed)
+		{
+			camy_warning("Can't change the maximum number of items while items are being queued or waiting to be executed");
+			return;
+		}
+
+		// Starting from scratch, handles are not valid anymore
+		m_render_items.clear();
+		m_keys.clear();
+		m_sort_entries.clear();
+		m_in_sort_entries.clear();
+		m_alive.clear();
+		m_free_slots.clear();
+		m_added_slots.clear();
+		m_retained_dirty = m_retained;
+
+		// Ranges are reserved again only when used
+		m_render_items.set_max_size(max_items);
+		m_reorder_scratch.clear();
+		m_reorder_scratch.set_max_size(max_items);
+		for (auto& segment : m_segments)
+		{
+			segment.items.clear();
+			segment.keys.clear();
+			segment.items.set_max_size(max_items);
+		}
+	}
+
+	template <typename ItemType>
+	typename Queue<ItemType>::Handle Queue<ItemType>::add_item(Key key)
+	{
+		if (m_state != State::Queueing || !m_retained)
+		{
+			camy_warning("Items can be added only to retained queues between begin() and end()");
+			return invalid_handle;
+		}
+
+		// Reusing slots of removed items first
+		Handle handle;
+		if (!m_free_slots.empty())
+		{
+			handle = m_free_slots.back();
+			m_free_slots.pop_back();
+			m_render_items[handle] = ItemType();
+		}
+		else
+		{
+			handle = static_cast<Handle>(m_render_items.size());
+			if (m_render_items.emplace_back() == nullptr)
+				return invalid_handle;
+
+			m_keys.push_back(0);
+			m_alive.push_back(0);
+			m_in_sort_entries.push_back(0);
+		}
+
+		m_render_items[handle].key = key;
+		m_keys[handle] = key;
+		m_alive[handle] = 1;
+
+		m_added_slots.push_back(handle);
+		m_retained_dirty = true;
+
+		return handle;
+	}
+
+	template <typename ItemType>
+	ItemType* Queue<ItemType>::get_item(Handle handle)
+	{
+		if (m_state != State::Queueing)
+		{
+			camy_warning("Items can be patched only between begin() and end()");
+			return nullptr;
+		}
+
+		camy_assert(handle < m_alive.size() && m_alive[handle], { return nullptr; }, "Invalid item handle: ", handle);
+
+		return &m_render_items[handle];
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::set_key(Handle handle, Key key)
+	{
+		if (m_state != State::Queueing)
+		{
+			camy_warning("Can't set key outside of a begin() / end() block");
+			return;
+		}
+
+		camy_assert(handle < m_alive.size() && m_alive[handle], { return; }, "Invalid item handle: ", handle);
+
+		// Same key => same order, nothing to sort
+		if (m_keys[handle] == key)
+			return;
+
+		m_render_items[handle].key = key;
+		m_keys[handle] = key;
+		m_retained_dirty = true;
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::remove_item(Handle handle)
+	{
+		if (m_state != State::Queueing)
+		{
+			camy_warning("Items can be removed only between begin() and end()");
+			return;
+		}
+
+		camy_assert(handle < m_alive.size() && m_alive[handle], { return; }, "Invalid item handle: ", handle);
+
+		m_alive[handle] = 0;
+		m_free_slots.push_back(handle);
+		m_retained_dirty = true;
+	}
+
+	template <typename ItemType>
+	u32 Queue<ItemType>::get_num_retained_items()const
+	{
+		return m_render_items.size() - static_cast<u32>(m_free_slots.size());
+	}
+
+	template <typename ItemType>
+	typename Queue<ItemType>::Recorder Queue<ItemType>::create_recorder(u32 thread_index)
+	{
+		if (thread_index >= max_recorders)
+		{
+			camy_error("Thread index: ", thread_index, " is out of range, max recorders: ", static_cast<u32>(max_recorders));
+			return Recorder();
+		}
+
+		return Recorder(this, thread_index);
+	}
+
+	template <typename ItemType>
+	Queue<ItemType>::Recorder::Recorder() :
+		m_queue{ nullptr },
+		m_index{ 0 }
+	{
+
+	}
+
+	template <typename ItemType>
+	Queue<ItemType>::Recorder::Recorder(Queue* queue, u32 index) :
+		m_queue{ queue },
+		m_index{ index }
+	{
+
+	}
+
+	template <typename ItemType>
+	ItemType* Queue<ItemType>::Recorder::create_item(Key key)
+	{
+		if (m_queue == nullptr || m_queue->m_state != State::Queueing || m_queue->m_retained)
+		{
+			camy_warning("Can't create item before begin has been called or in a retained queue");
+			return nullptr;
+		}
+
+		// Nobody else is touching this segment
+		auto& segment{ m_queue->m_segments[m_index] };
+		auto item{ segment.items.emplace_back() };
+		if (item == nullptr)
+			return nullptr;
+
+		item->key = key;
+		segment.keys.push_back(key);
+
+		return item;
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::Recorder::set_key(ItemType* item, Key key)
+	{
+		if (m_queue == nullptr || m_queue->m_state != State::Queueing)
+		{
+			camy_warning("Can't set key outside of a begin() / end() block");
+			return;
+		}
+
+		auto& segment{ m_queue->m_segments[m_index] };
+		camy_assert(!segment.items.empty() && item >= &segment.items.front() && item <= &segment.items.back(), { return; }, "Item has not been created by this recorder");
+
+		item->key = key;
+		segment.keys[static_cast<u32>(item - &segment.items[0])] = key;
+	}
+	
+	template <typename ItemType>
+	void Queue<ItemType>::end(const ParameterGroup* shared_parameters, Dependency* dependencies, const u32 num_dependencies)
+	{
+		if (m_state == State::Executed)
+		{
+			camy_warning("Can't call end() before a begin has been called");
+			return;
+		}
+
+		if (m_state == State::Ready)
+		{
+			camy_warning("Can't call end() multiple times");
+			return;
+		}
+
+		m_shared_parameters = shared_parameters;
+
+		m_dependencies = dependencies;
+		m_num_dependencies = num_dependencies;
+
+		if (m_retained)
+		{
+			// Nothing has been added, removed or moved, previous order is still valid
+			if (!m_retained_dirty)
+			{
+				m_sort_method = SortMethod::None;
+				m_sort_disorder = 0;
+				m_state = State::Ready;
+				return;
+			}
+
+			_update_retained_entries();
+		}
+		else
+		{
+			_merge_segments();
+			_update_entries();
+		}
+
+		// Refreshing keys, still in previous frame order. This is the only gather and it's
+		// from the dense key array, not from the items
+		for (auto& entry : m_sort_entries)
+			entry.key = m_keys[entry.index];
+
+		// If size is the same we don't do anything, time to sort.
+		// Insertion sort makes full use of an almost sorted queue, but goes quadratic as soon as
+		// coherence is lost ( fast camera turns, lots of nodes popping in ), we measure how far
+		// from sorted the previous order is and switch to radix sort when it's not worth it anymore
+		m_sort_disorder = _measure_disorder();
+
+		if (m_sort_disorder == 0)
+			m_sort_method = SortMethod::None;
+		else if (m_sort_entries.size() >= radix_sort_min_items && m_sort_disorder * radix_sort_disorder_ratio > m_sort_entries.size())
+			m_sort_method = SortMethod::Radix;
+		else
+			m_sort_method = SortMethod::Insertion;
+
+		// Small queues are never worth the radix fixed cost, there is no budget for them
+		if (m_sort_method == SortMethod::Insertion)
+		{
+			const u64 max_moves{ m_sort_entries.size() >= radix_sort_min_items ? static_cast<u64>(m_sort_entries.size()) * radix_sort_max_moves_ratio : ~0ull };
+			if (!_insertion_sort(max_moves))
+				m_sort_method = SortMethod::Radix;
+		}
+
+		if (m_sort_method == SortMethod::Radix)
+			_radix_sort();
+
+		// Moving the items in sorted order, entries still refer to creation order 
+		// that is what the next frame will use. Retained items can't move, handles are slots
+		if (m_reorder_items && !m_retained)
+		{
+			// Same capacity as the items, this can't fail
+			m_reorder_scratch.clear();
+			for (const auto& entry : m_sort_entries)
+				m_reorder_scratch.push_back(m_render_items[entry.index]);
+			m_render_items.swap(m_reorder_scratch);
+		}
+
+		m_retained_dirty = false;
+
+		// Ready to be executed!
+		m_state = State::Ready;
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::_update_entries()
+	{
+		/*
+			Temporal coherence :
+			http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/
+			thanks L. Spiro
+		*/
+		const auto current_size{ m_sort_entries.size() };
+		const auto next_size{ m_keys.size() };
+
+		if (next_size > current_size)
+		{
+			// Adding last indices to the end of the queue
+			for (auto i{ current_size }; i < next_size; ++i)
+				m_sort_entries.push_back({ 0, static_cast<u32>(i) });
+		}
+
+		// We need to reset the indices
+		if (next_size < current_size)
+		{
+			m_sort_entries.resize(next_size); // Resetting to new size
+			for (auto i{ 0u }; i < next_size; ++i)
+				m_sort_entries[i].index = static_cast<u32>(i);
+		}
+
+#if camy_flags & camy_validate_states
+		for (auto i{ 0u }; i < next_size; ++i)
+		{
+			if (m_render_items[i].key != m_keys[i])
+			{
+				camy_warning("Item key has been written directly, it will be ignored when sorting, use create_item(key) or set_key()");
+				break;
+			}
+		}
+#endif
+
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::_update_retained_entries()
+	{
+		// Removing entries of removed items, the relative order of the others is preserved
+		auto next_free{ 0u };
+		for (auto i{ 0u }; i < m_sort_entries.size(); ++i)
+		{
+			const auto entry{ m_sort_entries[i] };
+			if (m_alive[entry.index])
+				m_sort_entries[next_free++] = entry;
+			else
+				m_in_sort_entries[entry.index] = 0;
+		}
+		m_sort_entries.resize(next_free);
+
+		// New items are appended, a slot might have been added and removed ( or reused ) in the same frame
+		for (auto handle : m_added_slots)
+		{
+			if (m_alive[handle] && !m_in_sort_entries[handle])
+			{
+				m_sort_entries.push_back({ 0, handle });
+				m_in_sort_entries[handle] = 1;
+			}
+		}
+		m_added_slots.clear();
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::_merge_segments()
+	{
+		auto num_recorded{ 0u };
+		for (const auto& segment : m_segments)
+			num_recorded += segment.items.size();
+
+		if (num_recorded == 0)
+			return;
+
+		m_keys.reserve(m_keys.size() + num_recorded);
+
+		// Always the same order, with the same work distribution the creation order is stable
+		// across frames and the sort keeps its temporal coherence. Items that don't fit are dropped
+		for (auto& segment : m_segments)
+		{
+			if (m_render_items.append(segment.items.data(), segment.items.size()))
+				m_keys.insert(m_keys.end(), segment.keys.begin(), segment.keys.end());
+
+			// Capacity is kept for the next frame
+			segment.items.clear();
+			segment.keys.clear();
+		}
+	}
+
+	template <typename ItemType>
+	u32 Queue<ItemType>::_measure_disorder()const
+	{
+		// Counting descents in the previous order, every descent is at least one item 
+		// that insertion sort has to move down. It's a single linear pass, but only a lower
+		// bound of the moves, _insertion_sort() is what keeps the actual work bounded
+		auto disorder{ 0u };
+		for (auto i{ 1u }; i < m_sort_entries.size(); ++i)
+		{
+			if (m_sort_entries[i].key < m_sort_entries[i - 1].key)
+				++disorder;
+		}
+
+		return disorder;
+	}
+
+	template <typename ItemType>
+	bool Queue<ItemType>::_insertion_sort(u64 max_moves)
+	{
+		// Does it matter if i sort from left to right ? cache ? 
+		const auto num_entries{ static_cast<u32>(m_sort_entries.size()) };
+		u64 num_moves{ 0 };
+		for (auto i{ 1u }; i < num_entries; ++i)
+		{
+			auto j{ i };
+			const auto entry_i{ m_sort_entries[i] };
+
+			while (j > 0 && entry_i.key < m_sort_entries[j - 1].key)
+			{
+				// Moving down & swapping j with j-1
+				m_sort_entries[j] = m_sort_entries[j - 1];
+				--j;
+			}
+
+			m_sort_entries[j] = entry_i;
+
+			// Out of budget, entries are still a stable permutation of the previous order 
+			// ( items only moved past greater keys ) that radix sort can take from here
+			num_moves += i - j;
+			if (num_moves > max_moves)
+				return false;
+		}
+
+		return true;
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::_radix_sort()
+	{
+		const u32 num_digits{ sizeof(Key) };
+		const auto num_entries{ static_cast<u32>(m_sort_entries.size()) };
+
+		// LSD radix sort, 8 bits per digit. Histograms for all the digits are built at once
+		u32 histograms[num_digits][256];
+		std::memset(histograms, 0, sizeof(histograms));
+		for (const auto& entry : m_sort_entries)
+		{
+			for (auto d{ 0u }; d < num_digits; ++d)
+				++histograms[d][(entry.key >> (d * 8)) & 0xFF];
+		}
+
+		m_sort_scratch.resize(num_entries);
+		auto src{ &m_sort_entries[0] };
+		auto dst{ &m_sort_scratch[0] };
+
+		for (auto d{ 0u }; d < num_digits; ++d)
+		{
+			auto histogram{ histograms[d] };
+
+			// Usually only a few bits of the key are in use, if all the entries fall
+			// in the same bucket the pass would not move anything
+			if (histogram[(src[0].key >> (d * 8)) & 0xFF] == num_entries)
+				continue;
+
+			// Exclusive prefix sum => first destination of each bucket
+			auto offset{ 0u };
+			for (auto b{ 0u }; b < 256; ++b)
+			{
+				const auto count{ histogram[b] };
+				histogram[b] = offset;
+				offset += count;
+			}
+
+			// Scattering is stable, equal keys keep the previous frame order as insertion sort does
+			for (auto i{ 0u }; i < num_entries; ++i)
+				dst[histogram[(src[i].key >> (d * 8)) & 0xFF]++] = src[i];
+
+			std::swap(src, dst);
+		}
+
+		// After an odd number of passes the result is in the scratch buffer
+		if (src != &m_sort_entries[0])
+			m_sort_entries.swap(m_sort_scratch);
+	}
+
+	template <typename ItemType>
+	const ItemType* Queue<ItemType>::get_items()const
+	{
+		if (m_state != State::Ready)
+		{
+			camy_error("Tried to retrieve render items before end() has been called, returning null");
+			return nullptr;
+		}
+
+		if (m_render_items.empty())
+			return nullptr;
+
+		return &m_render_items[0];
+	}
+
+	template <typename ItemType>
+	u32 Queue<ItemType>::get_num_items()const
+	{
+		if (m_state != State::Ready)
+		{
+			camy_error("Tried to retrieve number of render items before end() has been called, returning null");
+			return 0;
+		}
+
+		return static_cast<u32>(m_render_items.size());
+	}
+
+	template <typename ItemType>
+	const typename Queue<ItemType>::SortEntry* Queue<ItemType>::get_sort_entries()const
+	{
+		if (m_state != State::Ready)
+		{
+			camy_error("Tried to retrieve sort entries before end() has been called, returning null");
+			return nullptr;
+		}
+
+		// Items are already in order
+		if ((m_reorder_items && !m_retained) || m_sort_entries.empty())
+			return nullptr;
+
+		return &m_sort_entries[0];
+	}
+
+	template <typename ItemType>
+	u32 Queue<ItemType>::get_num_sort_entries()const
+	{
+		if (m_state != State::Ready)
+		{
+			camy_error("Tried to retrieve number of sort entries before end() has been called, returning null");
+			return 0;
+		}
+
+		return static_cast<u32>(m_sort_entries.size());
+	}
+
+	template <typename ItemType>
+	void Queue<ItemType>::tag_executed()
+	{
+		if (m_state == State::Executed)
+			camy_warning("Queue has been already tagged as executed executed!");
+		else if (m_state == State::Queueing)
+			camy_warning("Can't tag the queue as executed while queueing is till going on");
+		else // m_state == State::Ready
+			m_state = State::Executed;
+	}
 }
\ No newline at end of file
@@ -1,324 +1,380 @@
-#pragma once
-
-// camy
-#include "base.hpp"
-#include "com_utils.hpp"
-
-namespace camy
-{
-	namespace hidden
-	{
-		/*
-			The reason why there is no inheritance or virtual function for disposing is that this code is not going to change
-			and adding all this oopness doesn't really make sense in the end, no one will benefit from it
-		*/
-		struct Surface final
-		{
-			ID3D11Texture2D*			texture_2d{ nullptr };
-			ID3D11ShaderResourceView*	srv{ nullptr };
-			ID3D11RenderTargetView*		rtv{ nullptr };
-			ID3D11DepthStencilView*		dsv{ nullptr };
-			ID3D11UnorderedAccessView*  uav{ nullptr };
-			IDXGISwapChain*				swap_chain{ nullptr };
-			WindowHandle				window_handle{ nullptr };
-
-			void dispose();
-		};
-
-		struct Buffer final
-		{
-			ID3D11Buffer* buffer{ nullptr };
-			ID3D11ShaderResourceView* srv{ nullptr };
-			ID3D11UnorderedAccessView* uav{ nullptr };
-
-			void dispose();
-		};
-
-		struct VertexBuffer final
-		{
-			ID3D11Buffer* buffer{ nullptr };
-
-			void dispose();
-		};
-
-		struct IndexBuffer final
-		{
-			ID3D11Buffer* buffer{ nullptr };
-
-			void dispose();
-		};
-
-		struct ConstantBuffer final
-		{
-			ID3D11Buffer* buffer{ nullptr };
-
-			void dispose();
-		};
-
-		struct BlendState final
-		{
-			ID3D11BlendState* state{ nullptr };
-	
-			void dispose();
-		};
-
-		struct RasterizerState final
-		{
-			ID3D11RasterizerState* state{ nullptr };
-
-			void dispose();
-		};
-
-		struct InputSignature final
-		{
-			ID3D11InputLayout* input_layout{ nullptr };
-
-			void dispose();
-		};
-
-		struct Sampler final
-		{
-			ID3D11SamplerState* sampler{ nullptr };
-		
-			void dispose();
-		};
-
-		struct Shader final
-		{
-			ID3D11DeviceChild* shader{ nullptr };
-
-			void dispose();
-		};
-
-		struct DepthStencilState final
-		{
-			ID3D11DepthStencilState* state{ nullptr };
-
-			void dispose();
-		};
-
-	}
-
-	// Used when initializing surfaces with initial data 
-	// and multiple faces / arraysizes
-	struct SubSurface final
-	{
-		u32 pitch{ 0u };
-		u32 width{ 0u };
-		u32 height{ 0u };
-		u32 size{ 0u };
-		void* data{ 0u };
-	};
-
-	enum class PrimitiveTopology : u16
-	{
-		PointList,
-		TriangleList,
-		TriangleStrip,
-		LineList,
-		LineStrip
-	};
-
-	struct Viewport
-	{
-		float left, right;
-		float top, bottom;
-	};
-
-	enum class BindType : u32 
-	{
-		Sampler = 0,
-		Surface = 1,
-		Buffer  = 2,
-		ConstantBuffer,
-		LastValue
-	};
-
-	struct PipelineResource
-	{
-		PipelineResource(BindType type) : type{ type } { } 
-
-		BindType type;
-	};
-
-	struct Surface : PipelineResource
-	{
-		Surface() : PipelineResource(BindType::Surface) { };
-
-		enum class Format
-		{
-			Unknown,
-			// Compressed formats
-			BC1Unorm,
-			BC3Unorm,
-
-			// Typeless formats, used for surfaces in different contexts ( different views )
-			R16Typeless,
-
-			R32Typeless,
-			R24G8Typeless,
-			R24UnormX8Typeless,
-
-			// Uncompressed formats
-			RGBA8Unorm,
-			RGB16Float,
-			RGBA16Float,
-			RGBA32Float,
-			R16Float,
-			R16Unorm,
-			R32Float,
-
-			// Depth formats
-			D16Unorm,
-			D32Float,
-			D24UNorm_S8Uint,
-		};
-
-		static Format translate(u32 format);
-
-		struct Description
-		{
-			Format format_srv{ Format::Unknown };
-			Format format_rtv{ Format::Unknown };
-			Format format_dsv{ Format::Unknown };
-			Format format_uav{ Format::Unknown };
-			u32		width{ 0u };
-			u32		height{ 0u };
-			u8		msaa_level{ 1u };
-			bool	is_dynamic{ false };
-			Format format{ Format::Unknown };
-		};
-
-		Description description;
-
-		hidden::Surface hidden;
-	};
-
-	struct Buffer : PipelineResource
-	{
-		Buffer() : PipelineResource(BindType::Buffer) { } 
-
-		enum class Type
-		{
-			Structured
-			// Uav and more to come
-		};
-
-		Type type;
-		u32 element_size;
-		u32 element_count;
-		bool is_dynamic;
-		hidden::Buffer hidden;
-	};
-
-	struct VertexBuffer
-	{
-		u32  element_size;
-		u32  element_count;
-		bool is_dynamic;
-		
-		hidden::VertexBuffer hidden;
-	};
-
-	struct IndexBuffer
-	{
-		enum class Type
-		{
-			U16,
-			U32
-		};
-
-		Type index_type;
-		u32  element_count;
-
-		hidden::IndexBuffer hidden;
-	};
-
-	struct ConstantBuffer : PipelineResource
-	{
-		ConstantBuffer() : PipelineResource(BindType::ConstantBuffer) { } 
-
-		u32 size;
-		hidden::ConstantBuffer hidden;
-	};
-
-	/*
-		Todo: Render target indipendent blending
-	*/
-	struct BlendState
-	{
-		enum class Mode
-		{
-			Opaque,
-			Transparent,
-			Additive
-		};
-
-		Mode mode;
-
-		hidden::BlendState hidden;
-	};
-
-	struct RasterizerState
-	{
-		enum class Cull
-		{
-			Front, 
-			Back,
-			None
-		};
-
-		enum class Fill
-		{
-			Solid, 
-			Wireframe
-		};
-
-		Cull cull;
-		Fill fill;
-
-		hidden::RasterizerState hidden;
-	};
-
-	struct InputSignature
-	{
-		hidden::InputSignature hidden;
-	};
-
-	struct Sampler : PipelineResource
-	{
-		Sampler() : PipelineResource(BindType::Sampler) { } 
-
-		enum class Filter
-		{
-			Point,
-			Linear,
-			Anisotropic
-		};
-
-		enum class Comparison
-		{
-			Never,
-			Less,
-			LessEqual
-		};
-
-		enum class Address
-		{
-			Clamp,
-			Wrap,
-			Mirror
-		};
-
-		Filter	filter;
-		Comparison comparison;
-		Address address;
-
-		hidden::Sampler hidden;
-	};
-
-	struct DepthStencilState
-	{
-		hidden::DepthStencilState hidden;
-	};
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "com_utils.hpp"
+
+// C++ STL
+#include <atomic>
+
+namespace camy
+{
+	namespace hidden
+	{
+		/*
+			The reason why there is no inheritance or virtual function for disposing is that this code is not going to change
+			and adding all this oopness doesn't really make sense in the end, no one will benefit from it
+		*/
+		struct Surface final
+		{
+			ID3D11Texture2D*			texture_2d{ nullptr };
+			ID3D11ShaderResourceView*	srv{ nullptr };
+			ID3D11RenderTargetView*		rtv{ nullptr };
+			ID3D11DepthStencilView*		dsv{ nullptr };
+			ID3D11UnorderedAccessView*  uav{ nullptr };
+			IDXGISwapChain*				swap_chain{ nullptr };
+			WindowHandle				window_handle{ nullptr };
+
+			void dispose();
+		};
+
+		struct Buffer final
+		{
+			ID3D11Buffer* buffer{ nullptr };
+			ID3D11ShaderResourceView* srv{ nullptr };
+			ID3D11UnorderedAccessView* uav{ nullptr };
+
+			void dispose();
+		};
+
+		struct VertexBuffer final
+		{
+			ID3D11Buffer* buffer{ nullptr };
+
+			void dispose();
+		};
+
+		struct IndexBuffer final
+		{
+			ID3D11Buffer* buffer{ nullptr };
+
+			void dispose();
+		};
+
+		struct ConstantBuffer final
+		{
+			ID3D11Buffer* buffer{ nullptr };
+
+			void dispose();
+		};
+
+		struct BlendState final
+		{
+			ID3D11BlendState* state{ nullptr };
+	
+			void dispose();
+		};
+
+		struct RasterizerState final
+		{
+			ID3D11RasterizerState* state{ nullptr };
+
+			void dispose();
+		};
+
+		struct InputSignature final
+		{
+			ID3D11InputLayout* input_layout{ nullptr };
+
+			void dispose();
+		};
+
+		struct Sampler final
+		{
+			ID3D11SamplerState* sampler{ nullptr };
+		
+			void dispose();
+		};
+
+		struct Shader final
+		{
+			ID3D11DeviceChild* shader{ nullptr };
+
+			void dispose();
+		};
+
+		struct DepthStencilState final
+		{
+			ID3D11DepthStencilState* state{ nullptr };
+
+			void dispose();
+		};
+
+	}
+
+	// Used when initializing surfaces with initial data 
+	// and multiple faces / arraysizes
+	struct SubSurface final
+	{
+		u32 pitch{ 0u };
+		u32 width{ 0u };
+		u32 height{ 0u };
+		u32 size{ 0u };
+		void* data{ 0u };
+	};
+
+	enum class PrimitiveTopology : u16
+	{
+		PointList,
+		TriangleList,
+		TriangleStrip,
+		LineList,
+		LineStrip
+	};
+
+	struct Viewport
+	{
+		float left, right;
+		float top, bottom;
+	};
+
+	enum class BindType : u32 
+	{
+		Sampler = 0,
+		Surface = 1,
+		Buffer  = 2,
+		ConstantBuffer,
+		LastValue
+	};
+
+	struct PipelineResource
+	{
+		PipelineResource(BindType type) : type{ type } { } 
+
+		BindType type;
+	};
+
+	struct Surface : PipelineResource
+	{
+		Surface() : PipelineResource(BindType::Surface) { };
+
+		enum class Format
+		{
+			Unknown,
+			// Compressed formats
+			BC1Unorm,
+			BC3Unorm,
+
+			// Typeless formats, used for surfaces in different contexts ( different views )
+			R16Typeless,
+
+			R32Typeless,
+			R24G8Typeless,
+			R24UnormX8Typeless,
+
+			// Uncompressed formats
+			RGBA8Unorm,
+			RGB16Float,
+			RGBA16Float,
+			RGBA32Float,
+			R16Float,
+			R16Unorm,
+			R32Float,
+
+			// Depth formats
+			D16Unorm,
+			D32Float,
+			D24UNorm_S8Uint,
+		};
+
+		static Format translate(u32 format);
+
+		struct Description
+		{
+			Format format_srv{ Format::Unknown };
+			Format format_rtv{ Format::Unknown };
+			Format format_dsv{ Format::Unknown };
+			Format format_uav{ Format::Unknown };
+			u32		width{ 0u };
+			u32		height{ 0u };
+			u8		msaa_level{ 1u };
+			bool	is_dynamic{ false };
+			Format format{ Format::Unknown };
+		};
+
+		Description description;
+
+		// False while the initial data is being uploaded ( see GPUBackend::create_texture2D_async )
+		std::atomic<bool> is_ready{ true };
+
+		hidden::Surface hidden;
+	};
+
+	struct Buffer : PipelineResource
+	{
+		Buffer() : PipelineResource(BindType::Buffer) { } 
+
+		enum class Type
+		{
+			Structured
+			// Uav and more to come
+		};
+
+		Type type;
+		u32 element_size;
+		u32 element_count;
+		bool is_dynamic;
+		hidden::Buffer hidden;
+	};
+
+	struct VertexBuffer
+	{
+		u32  element_size;
+		u32  element_count;
+		bool is_dynamic;
+
+		// Optional copy of the elements in system memory, not owned. Set by whoever created the buffer
+		// if the data has to be read on the CPU ( see SoftwareRasterizer ), has to outlive the buffer
+		const void* cpu_data{ nullptr };
+
+		// False while the initial data is being uploaded ( see GPUBackend::create_vertex_buffer_async )
+		std::atomic<bool> is_ready{ true };
+		
+		hidden::VertexBuffer hidden;
+	};
+
+	struct IndexBuffer
+	{
+		enum class Type
+		{
+			U16,
+			U32
+		};
+
+		Type index_type;
+		u32  element_count;
+
+		// Same as VertexBuffer::cpu_data
+		const void* cpu_data{ nullptr };
+
+		// Same as VertexBuffer::is_ready
+		std::atomic<bool> is_ready{ true };
+
+		hidden::IndexBuffer hidden;
+	};
+
+	struct ConstantBuffer : PipelineResource
+	{
+		ConstantBuffer() : PipelineResource(BindType::ConstantBuffer) { } 
+
+		u32 size;
+		hidden::ConstantBuffer hidden;
+	};
+
+	/*
+		Todo: Render target indipendent blending
+	*/
+	struct BlendState
+	{
+		enum class Mode
+		{
+			Opaque,
+			Transparent,
+			Additive
+		};
+
+		// What create_blend_state deduplicates by
+		struct Description
+		{
+			Mode mode;
+		};
+
+		Mode mode;
+
+		hidden::BlendState hidden;
+	};
+
+	struct RasterizerState
+	{
+		enum class Cull
+		{
+			Front, 
+			Back,
+			None
+		};
+
+		enum class Fill
+		{
+			Solid, 
+			Wireframe
+		};
+
+		// What create_rasterizer_state deduplicates by, no padding as it's compared bytewise
+		struct Description
+		{
+			Cull  cull;
+			Fill  fill;
+			u32	  bias;
+			float bias_max;
+			float bias_slope;
+		};
+
+		Cull cull;
+		Fill fill;
+
+		hidden::RasterizerState hidden;
+	};
+
+	struct InputSignature
+	{
+		hidden::InputSignature hidden;
+	};
+
+	struct Sampler : PipelineResource
+	{
+		Sampler() : PipelineResource(BindType::Sampler) { } 
+
+		enum class Filter
+		{
+			Point,
+			Linear,
+			Anisotropic
+		};
+
+		enum class Comparison
+		{
+			Never,
+			Less,
+			LessEqual
+		};
+
+		enum class Address
+		{
+			Clamp,
+			Wrap,
+			Mirror
+		};
+
+		// What create_sampler deduplicates by
+		struct Description
+		{
+			Filter	   filter;
+			Address	   address;
+			Comparison comparison;
+		};
+
+		Filter	filter;
+		Comparison comparison;
+		Address address;
+
+		hidden::Sampler hidden;
+	};
+
+	struct DepthStencilState
+	{
+		hidden::DepthStencilState hidden;
+	};
+
+	/*
+		Function: resource_size
+			Approximate size in bytes of the memory taken by the resource, surfaces without mip levels.
+			States, shaders and signatures are not counted
+	*/
+	template <typename Type>
+	u64 resource_size(const Type& resource) { return 0; }
+	u64 resource_size(const Surface& surface);
+	u64 resource_size(const Buffer& buffer);
+	u64 resource_size(const VertexBuffer& vertex_buffer);
+	u64 resource_size(const IndexBuffer& index_buffer);
+	u64 resource_size(const ConstantBuffer& constant_buffer);
 }
\ No newline at end of file
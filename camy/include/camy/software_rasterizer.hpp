@@ -0,0 +1,187 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "math.hpp"
+#include "common_structs.hpp"
+#include "worker_pool.hpp"
+
+// C++ STL
+#include <vector>
+
+namespace camy
+{
+	// Forward declaration
+	class RenderLayer;
+
+	/*
+		Class: SoftwareRasterizer
+			Depth-only rasterizer running on the CPU, it consumes the same RenderItems as the depth pass and
+			outputs the same 0-1 non-linear depth ( D3D conventions: less depth test, near clipping at z = 0,
+			clockwise front faces, top-left pixel origin ). Useful as headless depth path, as CPU occlusion / shadow
+			source and as reference for the GPU depth buffer.
+			Only the positions are read: the first float3 of every element of vertex_buffer1, both the vertex and
+			index buffers need their cpu_data to be set, items without it are skipped ( see Stats ). Only triangle
+			lists are supported, cull mode is taken from the rasterizer state ( back if none ), the rest of the
+			common states is ignored and the whole target is covered.
+			Draws are only collected, flush() does the work in two parallel phases: triangles are transformed, clipped
+			and binned into screen tiles, then every tile is rasterized by a single thread four pixels at a time ( SSE ).
+			Edges are inclusive, pixels on an edge shared by two triangles are covered by both which is harmless
+			for depth.
+	*/
+	class SoftwareRasterizer final
+	{
+	public:
+		// Tile width is a multiple of the SIMD width
+		static const u32 tile_width{ 64 };
+		static const u32 tile_height{ 32 };
+
+		// Triangles set up by the same task, big draws are split
+		static const u32 max_triangles_per_task{ 4096 };
+
+		/*
+			Struct: Stats
+				Counters of the last flush(), triangles are all the triangles read. Culled ones are rejected
+				by the frustum, facing or because they don't cover any pixel center, clipped ones intersect
+				the near plane
+		*/
+		struct Stats
+		{
+			u32 num_draws{ 0 };
+			u32 num_skipped_draws{ 0 };
+			u32 num_triangles{ 0 };
+			u32 num_culled_triangles{ 0 };
+			u32 num_clipped_triangles{ 0 };
+			u32 num_binned_triangles{ 0 };
+		};
+
+		SoftwareRasterizer();
+		~SoftwareRasterizer();
+
+		SoftwareRasterizer(const SoftwareRasterizer& other) = delete;
+		SoftwareRasterizer& operator=(const SoftwareRasterizer& other) = delete;
+
+		/*
+			Function: resize
+				Reallocates the depth buffer, contents are undefined until the next clear
+		*/
+		bool resize(u32 width, u32 height);
+
+		/*
+			Function: set_num_workers
+				Number of threads other than the calling one used by flush(), 0 by default
+		*/
+		void set_num_workers(u32 num_workers);
+		u32 get_num_workers()const { return m_workers != nullptr ? m_workers->get_num_threads() - 1 : 0; }
+
+		void clear(float depth = 1.f);
+
+		/*
+			Function: set_view_projection
+				Used by the following draws, same convention as the shaders ( row vectors, world * view * projection ),
+				the matrix is *not* transposed
+		*/
+		void set_view_projection(const float4x4& view_projection);
+
+		/*
+			Function: draw
+				Queues the item, the buffers have to stay alive until flush(). If world is null the positions
+				are already in world space
+		*/
+		void draw(const RenderItem& render_item, const float4x4* world = nullptr);
+
+		/*
+			Function: draw
+				Queues all the items of the layer, the world matrix is the instance data if the layer has
+				instancing enabled with sizeof(float4x4) bytes ( see DepthPass )
+		*/
+		void draw(const RenderLayer& render_layer);
+
+		/*
+			Function: flush
+				Rasterizes all the queued draws into the depth buffer
+		*/
+		void flush();
+
+		u32 get_width()const { return m_width; }
+		u32 get_height()const { return m_height; }
+
+		// Rows are get_pitch() floats apart
+		const float* get_depth()const { return m_depth.empty() ? nullptr : &m_depth[0]; }
+		u32 get_pitch()const { return m_pitch; }
+
+		float get_depth(u32 x, u32 y)const { return m_depth[y * m_pitch + x]; }
+
+		const Stats& get_stats()const { return m_stats; }
+
+	private:
+		struct Draw
+		{
+			float world_view_projection[4][4];
+
+			const Byte* positions;
+			u32 stride;
+			u32 num_vertices;
+
+			const void* indices;
+			bool is_u32;
+
+			DrawInfo draw_info;
+			bool cull_back;
+			bool cull_front;
+		};
+
+		struct SetupTask
+		{
+			u32 draw;
+			u32 first_triangle;
+			u32 num_triangles;
+		};
+
+		// Edge functions ( e = a * x + b * y + c, inside if >= 0 ) and depth plane in pixel coordinates
+		struct Triangle
+		{
+			float a[3];
+			float b[3];
+			float c[3];
+
+			float z;
+			float dzdx;
+			float dzdy;
+
+			i32 min_x;
+			i32 min_y;
+			i32 max_x;
+			i32 max_y;
+		};
+
+		// Per thread, the setup phase doesn't share anything
+		struct ThreadBins
+		{
+			std::vector<Triangle> triangles;
+			std::vector<std::vector<u32>> tiles;
+			Stats stats;
+		};
+
+		void _setup(const SetupTask& task, ThreadBins& bins);
+		void _bin(const float (*clip)[4], const Draw& draw, ThreadBins& bins);
+		void _rasterize(u32 tile);
+
+	private:
+		u32 m_width;
+		u32 m_height;
+		u32 m_pitch;
+		u32 m_num_tiles_x;
+		u32 m_num_tiles_y;
+		std::vector<float> m_depth;
+
+		float4x4 m_view_projection;
+		std::vector<Draw> m_draws;
+		std::vector<SetupTask> m_setup_tasks;
+		std::vector<ThreadBins> m_thread_bins;
+		u32 m_num_skipped_draws;
+
+		WorkerPool* m_workers;
+		Stats m_stats;
+	};
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "hash.hpp"
+
+// C++ STL
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace camy
+{
+	/*
+		Class: StateObjectCache
+			Hash-consing of the immutable state objects ( samplers, blend, rasterizer and depth stencil states ).
+			Equal descriptions share the same object, which is reference counted: every acquire() has to be
+			matched by a release() ( see GPUBackend::dispose ). Sharing the object is what lets the bind path,
+			which compares states by address ( see PipelineCache and CommandStream ), skip equal states.
+			Descriptions are hashed and compared bytewise, thus they can't have padding.
+			Thread safe, objects are created under the lock as creation is not meant for the hot path.
+	*/
+	template <typename StateType, typename Description>
+	class StateObjectCache final
+	{
+	public:
+		using Create = std::function<StateType*(const Description& description)>;
+
+		StateObjectCache() = default;
+		~StateObjectCache() = default;
+
+		StateObjectCache(const StateObjectCache& other) = delete;
+		StateObjectCache& operator=(const StateObjectCache& other) = delete;
+
+		/*
+			Function: acquire
+				Returns the object for the description adding a reference, create is called the first time.
+				nullptr if creation failed
+		*/
+		StateType* acquire(const Description& description, const Create& create);
+
+		/*
+			Function: release
+				Drops a reference, returns true if it was the last one and the object has to be deallocated.
+				Objects not coming from the cache are always deallocated
+		*/
+		bool release(const StateType* state);
+
+		// Forgets all the objects, they are owned by the ResourceStorer
+		void clear();
+
+		u32 get_num_states()const;
+
+	private:
+		struct Entry
+		{
+			Description description;
+			StateType*	state;
+			u32			num_references;
+		};
+
+
+	private:
+		mutable std::mutex m_mutex;
+
+		// Entries bucketed by description hash, state -> hash to release
+		std::unordered_multimap<u32, Entry> m_entries;
+		std::unordered_map<const StateType*, u32> m_hashes;
+	};
+}
+
+#include "state_object_cache.inl"
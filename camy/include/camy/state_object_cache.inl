@@ -0,0 +1,74 @@
+// C++ STL
+#include <cstring>
+#include <type_traits>
+
+namespace camy
+{
+	template <typename StateType, typename Description>
+	StateType* StateObjectCache<StateType, Description>::acquire(const Description& description, const Create& create)
+	{
+		static_assert(std::is_trivially_copyable<Description>::value, "Descriptions are compared bytewise");
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const auto hash{ fnv1a(&description, sizeof(Description)) };
+		auto range{ m_entries.equal_range(hash) };
+		for (auto entry{ range.first }; entry != range.second; ++entry)
+		{
+			if (std::memcmp(&entry->second.description, &description, sizeof(Description)) == 0)
+			{
+				++entry->second.num_references;
+				return entry->second.state;
+			}
+		}
+
+		auto state{ create(description) };
+		if (state == nullptr)
+			return nullptr;
+
+		m_entries.emplace(hash, Entry{ description, state, 1 });
+		m_hashes.emplace(state, hash);
+		return state;
+	}
+
+	template <typename StateType, typename Description>
+	bool StateObjectCache<StateType, Description>::release(const StateType* state)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		auto found{ m_hashes.find(state) };
+		if (found == m_hashes.end())
+			return true;
+
+		auto range{ m_entries.equal_range(found->second) };
+		for (auto entry{ range.first }; entry != range.second; ++entry)
+		{
+			if (entry->second.state != state)
+				continue;
+
+			if (--entry->second.num_references > 0)
+				return false;
+
+			m_entries.erase(entry);
+			m_hashes.erase(found);
+			return true;
+		}
+
+		return true;
+	}
+
+	template <typename StateType, typename Description>
+	void StateObjectCache<StateType, Description>::clear()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries.clear();
+		m_hashes.clear();
+	}
+
+	template <typename StateType, typename Description>
+	u32 StateObjectCache<StateType, Description>::get_num_states()const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return static_cast<u32>(m_hashes.size());
+	}
+}
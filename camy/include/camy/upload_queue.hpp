@@ -0,0 +1,141 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+#include "resources.hpp"
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace camy
+{
+	/*
+		Class: UploadQueue
+			Pending copies of system memory blobs to resources, filled by the GPUBackend::create_*_async functions
+			and drained by GPUBackend::process_uploads once per frame up to a byte budget. Blobs are copied on
+			submission, the caller can release its memory right away.
+			Every upload is a list of subresources ( a buffer has only one ) made of rows, a buffer row is a single
+			byte, a surface row is whatever the pitch of the subsurface covers ( e.g. 4 texel rows for block compressed
+			formats ). Copies are split at row granularity, thus a big upload spans several frames, and uploads complete
+			in submission order. The is_ready flag of the resource is set once its last row has been copied.
+			Submitting is thread safe, process() and cancel() are meant to be called by the thread owning the device
+			context but are safe too.
+	*/
+	class UploadQueue final
+	{
+	public:
+		enum class Type
+		{
+			VertexBuffer,
+			IndexBuffer,
+			Surface
+		};
+
+		/*
+			Struct: Chunk
+				Rows [first_row, first_row + num_rows) of a subresource, data points to the first of them.
+				num_subresource_rows is the total for the subresource
+		*/
+		struct Chunk
+		{
+			Type		type;
+			void*		resource;
+			u32			subresource;
+			const Byte* data;
+			u32			pitch;
+			u32			first_row;
+			u32			num_rows;
+			u32			num_subresource_rows;
+		};
+
+		/*
+			Struct: Stats
+				Counters of the last process(), latency is the time in milliseconds from submission to completion of
+				the uploads completed in it. Pending ones are left for the next frames
+		*/
+		struct Stats
+		{
+			u64   uploaded_size{ 0 };
+			u32   num_copies{ 0 };
+			u32   num_completed{ 0 };
+			float average_latency{ 0.f };
+			float max_latency{ 0.f };
+			u32   num_pending{ 0 };
+			u64   pending_size{ 0 };
+		};
+
+		// Copies a chunk to the resource, backend specific
+		using Copy = std::function<void(const Chunk& chunk)>;
+
+		UploadQueue();
+		~UploadQueue() = default;
+
+		UploadQueue(const UploadQueue& other) = delete;
+		UploadQueue& operator=(const UploadQueue& other) = delete;
+
+		/*
+			Function: submit
+				Queues size bytes of data for the buffer and clears its is_ready flag
+		*/
+		void submit(VertexBuffer* vertex_buffer, const void* data, u32 size);
+		void submit(IndexBuffer* index_buffer, const void* data, u32 size);
+
+		/*
+			Function: submit
+				Queues one subsurface per mip level ( see GPUBackend::create_texture2D ) and clears the is_ready flag
+		*/
+		void submit(Surface* surface, const SubSurface* subsurfaces, u32 num_subsurfaces);
+
+		/*
+			Function: process
+				Copies up to budget bytes, at least one row is copied even if it exceeds the budget otherwise
+				rows bigger than it would never complete
+		*/
+		void process(u64 budget, const Copy& copy);
+
+		/*
+			Function: cancel
+				Drops the pending upload of the resource if any, has to be called before releasing it
+		*/
+		void cancel(const void* resource);
+
+		void clear();
+
+		Stats get_stats()const;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		struct Subresource
+		{
+			Size offset;
+			u32  pitch;
+			u32  num_rows;
+		};
+
+		struct Upload
+		{
+			Type type;
+			void* resource;
+			std::atomic<bool>* is_ready;
+			std::vector<Byte> data;
+			std::vector<Subresource> subresources;
+			u32 next_subresource;
+			u32 next_row;
+			Clock::time_point submission_time;
+		};
+
+		void _submit(Upload&& upload);
+
+	private:
+		mutable std::mutex m_mutex;
+		std::deque<Upload> m_uploads;
+		u64 m_pending_size;
+		Stats m_stats;
+	};
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+// camy
+#include "base.hpp"
+
+// C++ STL
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace camy
+{
+	/*
+		Class: WorkerPool
+			Small pool of persistent threads used to run batches of independent tasks ( e.g. compiling
+			the layers, see LayerDispatcher ). Threads sleep in between batches, the calling thread
+			takes part in the batch as thread 0, so a pool with 0 workers simply runs the tasks serially.
+			Only one batch can be in flight at a time, run() is not reentrant.
+	*/
+	class WorkerPool final
+	{
+	public:
+		/*
+			Parameters are the index of the task and the index of the thread running it [0, get_num_threads())
+		*/
+		using Task = std::function<void(u32 task, u32 thread_index)>;
+
+		/*
+			Constructor: WorkerPool
+				Spawns num_workers threads other than the calling one
+		*/
+		WorkerPool(u32 num_workers);
+
+		/*
+			Destructor: ~WorkerPool
+				Waits for the workers to exit
+		*/
+		~WorkerPool();
+
+		WorkerPool(const WorkerPool& other) = delete;
+		WorkerPool& operator=(const WorkerPool& other) = delete;
+
+		/*
+			Function: run
+				Runs num_tasks tasks and returns once all of them have completed
+		*/
+		void run(u32 num_tasks, const Task& task);
+
+		u32 get_num_threads()const { return static_cast<u32>(m_workers.size()) + 1; }
+
+	private:
+		void _work(u32 thread_index);
+		void _run_tasks(u32 thread_index);
+
+	private:
+		std::vector<std::thread> m_workers;
+
+		std::mutex				m_mutex;
+		std::condition_variable m_wake;
+		std::condition_variable m_done;
+
+		// Current batch, protected by m_mutex except m_next_task
+		const Task*		 m_task;
+		u32				 m_num_tasks;
+		std::atomic<u32> m_next_task;
+		u32				 m_num_busy_workers;
+		u64				 m_batch;
+		bool			 m_quit;
+	};
+}
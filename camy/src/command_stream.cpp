@@ -0,0 +1,761 @@
+// Header
+#include <camy/command_stream.hpp>
+
+// camy
+#include <camy/layers.hpp>
+#include <camy/cbuffer_system.hpp>
+#include <camy/pipeline_cache.hpp>
+#include <camy/pipeline_state.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace camy
+{
+	namespace
+	{
+		bool same_parameters(const ParameterGroup* a, const ParameterGroup* b)
+		{
+			if (a == b)
+				return true;
+
+			if (a == nullptr || b == nullptr || a->num_parameters != b->num_parameters)
+				return false;
+
+			for (auto i{ 0u }; i < a->num_parameters; ++i)
+			{
+				const auto& pa{ a->parameters[i] };
+				const auto& pb{ b->parameters[i] };
+
+				if (pa.data != pb.data ||
+					pa.shader_variable.type != pb.shader_variable.type ||
+					pa.shader_variable.slot != pb.shader_variable.slot ||
+					pa.shader_variable.shader_type != pb.shader_variable.shader_type ||
+					pa.shader_variable.is_uav != pb.shader_variable.is_uav)
+					return false;
+			}
+
+			return true;
+		}
+
+		/*
+			Two items can be part of the same instanced draw call if everything but the instance data matches.
+			Parameter groups are usually allocated per item, they are compared by content
+		*/
+		bool can_instance(const RenderItem& first, const RenderItem& other)
+		{
+			if (other.instance_data == nullptr ||
+				first.vertex_buffer1 != other.vertex_buffer1 ||
+				first.vertex_buffer2 != other.vertex_buffer2 ||
+				first.index_buffer != other.index_buffer ||
+				first.vertex_shader != other.vertex_shader ||
+				first.pixel_shader != other.pixel_shader ||
+				first.geometry_shader != other.geometry_shader ||
+				first.common_states != other.common_states ||
+				first.pipeline_state != other.pipeline_state ||
+				first.draw_info.index_count != other.draw_info.index_count ||
+				first.draw_info.index_offset != other.draw_info.index_offset ||
+				first.draw_info.vertex_offset != other.draw_info.vertex_offset ||
+				first.draw_info.primitive_topology != other.draw_info.primitive_topology ||
+				first.num_cached_parameter_groups != other.num_cached_parameter_groups)
+				return false;
+
+			for (auto pg{ 0u }; pg < first.num_cached_parameter_groups; ++pg)
+			{
+				if (first.cached_parameter_groups[pg].cache_slot != other.cached_parameter_groups[pg].cache_slot ||
+					!same_parameters(first.cached_parameter_groups[pg].parameter_group, other.cached_parameter_groups[pg].parameter_group))
+					return false;
+			}
+
+			return true;
+		}
+
+		// Number of PipelineStates flags set
+		u32 count_states(u32 states)
+		{
+			u32 count{ 0 };
+			for (; states != 0; states &= states - 1)
+				++count;
+			return count;
+		}
+	}
+
+	void CommandStream::clear()
+	{
+		// Capacity is kept
+		m_data.clear();
+		m_constant_data.clear();
+		m_stats = Stats();
+		_reset_cache();
+	}
+
+	void CommandStream::swap(CommandStream& other)
+	{
+		m_data.swap(other.m_data);
+		m_constant_data.swap(other.m_constant_data);
+		std::swap(m_stats, other.m_stats);
+		std::swap(m_cache, other.m_cache);
+	}
+
+	void CommandStream::clear_surface(const Surface* surface, const float* color, const float depth, const u32 stencil)
+	{
+		if (surface == nullptr)
+		{
+			camy_warning("Tried to clear a null surface");
+			return;
+		}
+
+		auto clear{ push<ClearSurfaceCommand>() };
+		clear->surface = surface;
+		clear->depth = depth;
+		clear->stencil = stencil;
+		clear->has_color = color != nullptr;
+		if (color != nullptr)
+			std::memcpy(clear->color, color, sizeof(float) * 4);
+	}
+
+	void CommandStream::update(const Buffer* buffer, const void* data)
+	{
+		if (buffer == nullptr)
+		{
+			camy_error("Can't update null buffer / resource");
+			return;
+		}
+
+		if (data == nullptr)
+		{
+			camy_error("Can't update buffer with null data");
+			return;
+		}
+
+		const auto data_size{ buffer->element_count * buffer->element_size };
+
+		auto update{ push<UpdateBufferCommand>(data_size) };
+		update->buffer = buffer;
+		update->data_size = data_size;
+		std::memcpy(const_cast<Byte*>(update->get_data()), data, data_size);
+
+		++m_stats.num_uploads;
+		m_stats.upload_size += data_size;
+	}
+
+	void CommandStream::unbind_outputs()
+	{
+		push<UnbindOutputsCommand>();
+
+		// Backend resets the common states too
+		m_cache.states_set &= ~PipelineStates_CommonStates;
+	}
+
+	void CommandStream::compile(const RenderLayer& render_layer)
+	{
+		clear();
+
+		const auto instance_data_size{ render_layer.get_instance_data_size() };
+		if (instance_data_size > features::instance_buffer_size)
+		{
+			camy_error("Instance data size: ", instance_data_size, " exceeds the instance buffer size: ", features::instance_buffer_size);
+			return;
+		}
+
+		const auto max_instances{ instance_data_size > 0 ? features::instance_buffer_size / instance_data_size : 1u };
+
+		// Instance data is read from its own stream, bound once for the whole layer
+		if (instance_data_size > 0)
+			push<SetInstanceStreamCommand>()->stride = instance_data_size;
+
+		// Items of an instanced layer without instance data
+		auto num_skipped_items{ 0u };
+
+		for (auto rq{ 0u }; rq < render_layer.get_num_render_queues(); ++rq)
+		{
+			const auto& render_queue{ render_layer.get_render_queues()[rq] };
+
+			const auto render_items{ render_queue.get_items() };
+			const auto num_render_items{ render_queue.get_num_sort_entries() };
+
+			// Null if the items have already been moved in sorted order
+			const auto sort_entries{ render_queue.get_sort_entries() };
+
+			// Warning should be issued by higher levels
+			if (render_items == nullptr || num_render_items == 0)
+				continue;
+
+			auto item_at = [&](u32 index) -> const RenderItem& { return sort_entries == nullptr ? render_items[index] : render_items[sort_entries[index].index]; };
+
+			for (auto i{ 0u }; i < num_render_items; ++i)
+			{
+				const auto& render_item{ item_at(i) };
+
+				if (render_item.pipeline_state != nullptr)
+					_set_pipeline_state(*render_item.pipeline_state);
+				else
+				{
+					_set_common_states(render_item.common_states);
+					_set_primitive_topology(render_item.draw_info.primitive_topology);
+					_set_shader(Shader::Type::Vertex, render_item.vertex_shader);
+					_set_shader(Shader::Type::Geometry, render_item.geometry_shader);
+					_set_shader(Shader::Type::Pixel, render_item.pixel_shader);
+				}
+
+				_set_vertex_buffer(0, render_item.vertex_buffer1);
+				_set_vertex_buffer(1, render_item.vertex_buffer2);
+				_set_index_buffer(render_item.index_buffer);
+
+				// Exlusivity between shared_parameters and single parameters has to be guaranteed by the user
+				if (i == 0)
+					_bind_parameters(render_queue.get_shared_parameters());
+
+				for (auto pg{ 0u }; pg < render_item.num_cached_parameter_groups; ++pg)
+				{
+					const auto& cached_parameter_group{ render_item.cached_parameter_groups[pg] };
+					const auto parameter_group{ cached_parameter_group.parameter_group };
+
+					if (parameter_group == nullptr)
+					{
+						camy_warning("Skipping cached parameter gruop slot: ", cached_parameter_group.cache_slot, " & index: ", pg, ". Associated ParameterGroup is null");
+						continue;
+					}
+
+					// Same group in the same cache slot as the previous item, nothing to do
+					if (m_cache.parameter_groups[cached_parameter_group.cache_slot] == parameter_group)
+					{
+						m_stats.num_redundant_binds += parameter_group->num_parameters;
+						continue;
+					}
+
+					_bind_parameters(*parameter_group);
+					m_cache.parameter_groups[cached_parameter_group.cache_slot] = parameter_group;
+				}
+
+				if (instance_data_size == 0)
+				{
+					push<DrawCommand>()->draw_info = render_item.draw_info;
+					++m_stats.num_draws;
+					++m_stats.num_instances;
+					continue;
+				}
+
+				// Warned about once per compile, this would flood the log every frame
+				if (render_item.instance_data == nullptr)
+				{
+					++num_skipped_items;
+					continue;
+				}
+
+				// Collapsing the following compatible items, states have been set by the first one
+				auto num_instances{ 1u };
+				while (i + num_instances < num_render_items && num_instances < max_instances &&
+					can_instance(render_item, item_at(i + num_instances)))
+					++num_instances;
+
+				auto draw{ push<DrawInstancedCommand>(num_instances * instance_data_size) };
+				draw->draw_info = render_item.draw_info;
+				draw->num_instances = num_instances;
+				draw->instance_data_size = instance_data_size;
+
+				auto instance_data{ const_cast<Byte*>(draw->get_instance_data()) };
+				for (auto j{ 0u }; j < num_instances; ++j)
+					std::memcpy(instance_data + j * instance_data_size, item_at(i + j).instance_data, instance_data_size);
+
+				++m_stats.num_draws;
+				m_stats.num_instances += num_instances;
+
+				i += num_instances - 1;
+			}
+
+			// Dependencies are unbound after all the items of the queue
+			for (auto i{ 0u }; i < render_queue.get_num_dependencies(); ++i)
+				unbind(render_queue.get_dependencies()[i]);
+		}
+
+		if (num_skipped_items > 0)
+			camy_warning("Skipped ", num_skipped_items, " render items with no instance data in instanced layer");
+	}
+
+	void CommandStream::compile(const ComputeLayer& compute_layer)
+	{
+		clear();
+
+		const auto& compute_queue{ *compute_layer.get_queue() };
+
+		const auto compute_items{ compute_queue.get_items() };
+		const auto num_compute_items{ compute_queue.get_num_sort_entries() };
+		const auto sort_entries{ compute_queue.get_sort_entries() };
+
+		// Warning should be issued by higher levels
+		if (compute_items == nullptr || num_compute_items == 0)
+			return;
+
+		for (auto i{ 0u }; i < num_compute_items; ++i)
+			compile(sort_entries == nullptr ? compute_items[i] : compute_items[sort_entries[i].index]);
+	}
+
+	void CommandStream::compile(const ComputeItem& compute_item)
+	{
+		if (!(compute_item.group_countx + compute_item.group_county + compute_item.group_countz))
+		{
+			camy_warning("Skipping compute item, total dispatch count is 0");
+			return;
+		}
+
+		if (compute_item.compute_shader == nullptr)
+		{
+			camy_warning("Skipping compute item, no program specified");
+			return;
+		}
+
+		_set_shader(Shader::Type::Compute, compute_item.compute_shader);
+		_bind_parameters(compute_item.parameters);
+
+		auto dispatch{ push<DispatchCommand>() };
+		dispatch->group_countx = compute_item.group_countx;
+		dispatch->group_county = compute_item.group_county;
+		dispatch->group_countz = compute_item.group_countz;
+		++m_stats.num_dispatches;
+	}
+
+	void CommandStream::compile(const PostProcessLayer& pp_layer)
+	{
+		clear();
+
+		auto shared_parameters{ pp_layer.get_shared_parameters() };
+		if (shared_parameters != nullptr)
+			_bind_parameters(*shared_parameters);
+
+		const Surface* previous_output{ nullptr };
+		for (auto i{ 0u }; i < pp_layer.get_num_items(); ++i)
+		{
+			const auto& pp_item{ pp_layer.get_items()[i] };
+
+			if (pp_item.pixel_shader == nullptr ||
+				pp_item.output_surface == nullptr)
+			{
+				camy_warning("Can't execute post processing item without a pixel shader or an output surface specified specified");
+				continue;
+			}
+
+			_bind_parameters(pp_item.parameters);
+
+			// Input is the previous output unless specified
+			auto pp{ push<PostProcessCommand>() };
+			pp->pixel_shader = pp_item.pixel_shader;
+			pp->input_surface = pp_item.input_surface != nullptr ? pp_item.input_surface : previous_output;
+			pp->output_surface = pp_item.output_surface;
+			pp->blend_state = pp_item.blend_state;
+			++m_stats.num_draws;
+			++m_stats.num_instances;
+
+			previous_output = pp_item.output_surface;
+
+			// Replaying the item touches shaders, targets and the input slot behind the cache's back
+			m_cache.pipeline_state = nullptr;
+			m_cache.states_set &= ~(PipelineStates_CommonStates | PipelineStates_VertexShader | PipelineStates_PixelShader);
+			_forget_hazards(pp_item.output_surface, HazardTracker::Usage::RenderTarget);
+			m_cache.resources[static_cast<u32>(Shader::Type::Pixel)][0] = nullptr;
+		}
+	}
+
+	void CommandStream::_set_pipeline_state(const PipelineState& pipeline_state)
+	{
+		static const u32 pipeline_states{ PipelineStates_CommonStates | PipelineStates_PrimitiveTopology |
+			PipelineStates_VertexShader | PipelineStates_GeometryShader | PipelineStates_PixelShader };
+
+		// Single compare if the same pipeline state is still bound, otherwise the ids tell what changed
+		u32 changed{ pipeline_states };
+		if (m_cache.pipeline_state != nullptr)
+			changed = PipelineState::diff(m_cache.pipeline_state->get_id(), pipeline_state.get_id());
+		changed |= pipeline_states & ~m_cache.states_set;
+
+		if (changed == PipelineStates_None)
+		{
+			m_stats.num_redundant_binds += count_states(pipeline_states);
+			return;
+		}
+
+		const auto& description{ pipeline_state.get_description() };
+		if (changed & PipelineStates_CommonStates)
+		{
+			// Parts are compared only if the previous states are known
+			const auto changed_parts{ (m_cache.states_set & PipelineStates_CommonStates) && m_cache.common_states != nullptr ?
+				diff_common_states(*m_cache.common_states, description.common_states) : static_cast<u32>(CommonStatesParts_All) };
+			_push_common_states(&description.common_states, changed_parts);
+		}
+		if (changed & PipelineStates_PrimitiveTopology)
+			_push_primitive_topology(description.primitive_topology);
+		if (changed & PipelineStates_VertexShader)
+			_push_shader(Shader::Type::Vertex, description.vertex_shader);
+		if (changed & PipelineStates_GeometryShader)
+			_push_shader(Shader::Type::Geometry, description.geometry_shader);
+		if (changed & PipelineStates_PixelShader)
+			_push_shader(Shader::Type::Pixel, description.pixel_shader);
+
+		m_stats.num_redundant_binds += count_states(pipeline_states & ~changed);
+
+		m_cache.pipeline_state = &pipeline_state;
+	}
+
+	void CommandStream::_set_common_states(const CommonStates* common_states)
+	{
+		if ((m_cache.states_set & PipelineStates_CommonStates) && m_cache.common_states == common_states)
+		{
+			++m_stats.num_redundant_binds;
+			return;
+		}
+
+		// Different objects might still hold the same states, only the parts that differ are set
+		u32 changed_parts{ CommonStatesParts_All };
+		if ((m_cache.states_set & PipelineStates_CommonStates) && m_cache.common_states != nullptr && common_states != nullptr)
+		{
+			changed_parts = diff_common_states(*m_cache.common_states, *common_states);
+			if (changed_parts == CommonStatesParts_None)
+			{
+				m_cache.common_states = common_states;
+				++m_stats.num_redundant_binds;
+				return;
+			}
+		}
+
+		_push_common_states(common_states, changed_parts);
+	}
+
+	void CommandStream::_push_common_states(const CommonStates* common_states, u32 changed_parts)
+	{
+		// Copied, common states might be changed while recording the next frame
+		auto command{ push<SetCommonStatesCommand>() };
+		command->use_defaults = common_states == nullptr;
+		command->changed_parts = changed_parts;
+		if (common_states != nullptr)
+			command->common_states = *common_states;
+
+		m_cache.pipeline_state = nullptr;
+		m_cache.common_states = common_states;
+		m_cache.states_set |= PipelineStates_CommonStates;
+		++m_stats.num_binds;
+
+		if (common_states != nullptr && (changed_parts & CommonStatesParts_Outputs))
+		{
+			for (auto i{ 0u }; i < features::max_cachable_rts; ++i)
+				_forget_hazards(common_states->render_targets[i], HazardTracker::Usage::RenderTarget);
+			_forget_hazards(common_states->depth_buffer, HazardTracker::Usage::DepthStencil);
+		}
+	}
+
+	void CommandStream::_set_vertex_buffer(u32 slot, const VertexBuffer* vertex_buffer)
+	{
+		const u32 state{ slot == 0 ? PipelineStates_VertexBuffer1 : PipelineStates_VertexBuffer2 };
+		if ((m_cache.states_set & state) && m_cache.vertex_buffers[slot] == vertex_buffer)
+		{
+			++m_stats.num_redundant_binds;
+			return;
+		}
+
+		auto command{ push<SetVertexBufferCommand>() };
+		command->vertex_buffer = vertex_buffer;
+		command->slot = slot;
+
+		m_cache.vertex_buffers[slot] = vertex_buffer;
+		m_cache.states_set |= state;
+		++m_stats.num_binds;
+	}
+
+	void CommandStream::_set_index_buffer(const IndexBuffer* index_buffer)
+	{
+		if ((m_cache.states_set & PipelineStates_IndexBuffer) && m_cache.index_buffer == index_buffer)
+		{
+			++m_stats.num_redundant_binds;
+			return;
+		}
+
+		push<SetIndexBufferCommand>()->index_buffer = index_buffer;
+		m_cache.index_buffer = index_buffer;
+		m_cache.states_set |= PipelineStates_IndexBuffer;
+		++m_stats.num_binds;
+	}
+
+	void CommandStream::_set_primitive_topology(PrimitiveTopology primitive_topology)
+	{
+		if ((m_cache.states_set & PipelineStates_PrimitiveTopology) && m_cache.primitive_topology == primitive_topology)
+		{
+			++m_stats.num_redundant_binds;
+			return;
+		}
+
+		_push_primitive_topology(primitive_topology);
+	}
+
+	void CommandStream::_push_primitive_topology(PrimitiveTopology primitive_topology)
+	{
+		push<SetPrimitiveTopologyCommand>()->primitive_topology = primitive_topology;
+
+		m_cache.pipeline_state = nullptr;
+		m_cache.primitive_topology = primitive_topology;
+		m_cache.states_set |= PipelineStates_PrimitiveTopology;
+		++m_stats.num_binds;
+	}
+
+	namespace
+	{
+		const u32 shader_states[Shader::num_types]{ PipelineStates_VertexShader, PipelineStates_GeometryShader, PipelineStates_PixelShader, PipelineStates_ComputeShader };
+	}
+
+	void CommandStream::_set_shader(Shader::Type shader_type, const Shader* shader)
+	{
+		const auto type_index{ static_cast<u32>(shader_type) };
+		if ((m_cache.states_set & shader_states[type_index]) && m_cache.shaders[type_index] == shader)
+		{
+			++m_stats.num_redundant_binds;
+			return;
+		}
+
+		_push_shader(shader_type, shader);
+	}
+
+	void CommandStream::_push_shader(Shader::Type shader_type, const Shader* shader)
+	{
+		const auto type_index{ static_cast<u32>(shader_type) };
+
+		auto command{ push<SetShaderCommand>() };
+		command->shader = shader;
+		command->shader_type = shader_type;
+
+		// Compute shaders are not part of the pipeline states
+		if (shader_type != Shader::Type::Compute)
+			m_cache.pipeline_state = nullptr;
+		m_cache.shaders[type_index] = shader;
+		m_cache.states_set |= shader_states[type_index];
+		++m_stats.num_binds;
+	}
+
+	void CommandStream::_bind_parameters(const ParameterGroup& parameters)
+	{
+		for (auto i{ 0u }; i < parameters.num_parameters; ++i)
+		{
+			const auto& parameter{ parameters.parameters[i] };
+
+			if (parameter.data == nullptr)
+			{
+				camy_warning("Failed to set parameter, invalid data in PipelineParameter"); // Todo : dump shader variable
+				continue;
+			}
+
+			if (parameter.shader_variable.valid == 0)
+			{
+				camy_warning("Invalid shader variable passed as parameter");
+				continue;
+			}
+
+			// Constant buffers are compared by data pointer, as the backend always did
+			auto cached{ _cached_binding(parameter.shader_variable) };
+			if (cached != nullptr && *cached == parameter.data)
+			{
+				++m_stats.num_redundant_binds;
+				continue;
+			}
+
+			if (parameter.shader_variable.type == static_cast<u32>(BindType::ConstantBuffer))
+			{
+				const u32 size{ parameter.shader_variable.size };
+				const u32 aligned_size{ (size + features::constant_data_alignment - 1) / features::constant_data_alignment * features::constant_data_alignment };
+				const auto offset{ get_constant_data_size() };
+				m_constant_data.resize(offset + aligned_size);
+				std::memcpy(&m_constant_data[offset], parameter.data, size);
+
+				auto upload{ push<UploadConstantsCommand>() };
+				upload->shader_variable = parameter.shader_variable;
+				upload->offset = offset;
+
+				++m_stats.num_uploads;
+				m_stats.upload_size += size;
+				m_stats.constant_data_size += aligned_size;
+			}
+			else
+				m_pending_binds.push_back(parameter);
+
+			if (cached != nullptr)
+			{
+				*cached = parameter.data;
+
+				const auto& variable{ parameter.shader_variable };
+				if (variable.type == static_cast<u32>(BindType::Surface) || variable.type == static_cast<u32>(BindType::Buffer))
+				{
+					auto& end{ variable.is_uav ? m_cache.uavs_end[variable.shader_type] : m_cache.resources_end[variable.shader_type] };
+					end = std::max<u32>(end, variable.slot + 1);
+				}
+			}
+		}
+
+		_push_bind_ranges();
+	}
+
+	namespace
+	{
+		BindRangeType range_type(const ShaderVariable& variable)
+		{
+			if (variable.type == static_cast<u32>(BindType::Sampler))
+				return BindRangeType::Sampler;
+
+			if (variable.is_uav && variable.shader_type == static_cast<u32>(Shader::Type::Compute))
+				return BindRangeType::UnorderedAccess;
+
+			return BindRangeType::ShaderResource;
+		}
+
+		// Order parameters are coalesced in: stage, slot space, slot
+		u32 range_sort_key(const ShaderVariable& variable)
+		{
+			return (variable.shader_type << 16) | (static_cast<u32>(range_type(variable)) << 8) | variable.slot;
+		}
+	}
+
+	void CommandStream::_push_bind_ranges()
+	{
+		if (m_pending_binds.empty())
+			return;
+
+		// Insertion sort, groups are small and often already sorted. Stable, if the same slot is set twice
+		// the last one wins as if they were bound one by one
+		for (auto i{ 1u }; i < m_pending_binds.size(); ++i)
+		{
+			const auto parameter{ m_pending_binds[i] };
+			const auto key{ range_sort_key(parameter.shader_variable) };
+
+			auto j{ i };
+			for (; j > 0 && range_sort_key(m_pending_binds[j - 1].shader_variable) > key; --j)
+				m_pending_binds[j] = m_pending_binds[j - 1];
+			m_pending_binds[j] = parameter;
+		}
+
+		auto first{ 0u };
+		while (first < m_pending_binds.size())
+		{
+			const auto first_key{ range_sort_key(m_pending_binds[first].shader_variable) };
+
+			// Extending the range as long as slots are consecutive, duplicates are skipped
+			auto last{ first };
+			auto num_parameters{ 1u };
+			while (last + 1 < m_pending_binds.size())
+			{
+				const auto key{ range_sort_key(m_pending_binds[last + 1].shader_variable) };
+				if (key == first_key + num_parameters - 1)
+					m_pending_binds[first + num_parameters - 1] = m_pending_binds[last + 1];
+				else if (key == first_key + num_parameters)
+					m_pending_binds[first + num_parameters++] = m_pending_binds[last + 1];
+				else
+					break;
+				++last;
+			}
+
+			const auto& variable{ m_pending_binds[first].shader_variable };
+			auto range{ push<BindRangeCommand>(num_parameters * static_cast<u32>(sizeof(PipelineParameter))) };
+			range->shader_type = static_cast<Shader::Type>(variable.shader_type);
+			range->range_type = range_type(variable);
+			range->first_slot = static_cast<u16>(variable.slot);
+			range->num_parameters = num_parameters;
+			range->padding = 0;
+			std::memcpy(const_cast<PipelineParameter*>(range->get_parameters()), &m_pending_binds[first], num_parameters * sizeof(PipelineParameter));
+
+			if (range->range_type != BindRangeType::Sampler)
+			{
+				const auto usage{ range->range_type == BindRangeType::UnorderedAccess ? HazardTracker::Usage::UnorderedAccess : HazardTracker::Usage::ShaderResource };
+				for (auto i{ 0u }; i < num_parameters; ++i)
+					_forget_hazards(m_pending_binds[first + i].data, usage);
+			}
+
+			++m_stats.num_binds;
+			m_stats.num_bound_parameters += num_parameters;
+			first = last + 1;
+		}
+
+		m_pending_binds.clear();
+	}
+
+	void CommandStream::unbind(const Dependency& dependency)
+	{
+		if (dependency.valid == 0)
+		{
+			camy_warning("Invalid dependency"); // Todo: dump dependency
+			return;
+		}
+
+		// Only shader resources and uavs are unbound by the backend
+		if (dependency.type != static_cast<u32>(BindType::Surface) && dependency.type != static_cast<u32>(BindType::Buffer))
+			return;
+
+		push<UnbindCommand>()->dependency = dependency;
+
+		auto cached{ _cached_binding(dependency) };
+		if (cached != nullptr)
+			*cached = nullptr;
+	}
+
+	void CommandStream::_forget_hazards(const void* resource, HazardTracker::Usage usage)
+	{
+		if (resource == nullptr)
+			return;
+
+		const bool forget_resources{ HazardTracker::conflicts(HazardTracker::Usage::ShaderResource, usage) };
+		const bool forget_uavs{ HazardTracker::conflicts(HazardTracker::Usage::UnorderedAccess, usage) };
+		for (auto shader_type{ 0u }; shader_type < Shader::num_types; ++shader_type)
+		{
+			for (auto slot{ 0u }; forget_resources && slot < m_cache.resources_end[shader_type]; ++slot)
+			{
+				if (m_cache.resources[shader_type][slot] == resource)
+					m_cache.resources[shader_type][slot] = nullptr;
+			}
+
+			for (auto slot{ 0u }; forget_uavs && slot < m_cache.uavs_end[shader_type]; ++slot)
+			{
+				if (m_cache.uavs[shader_type][slot] == resource)
+					m_cache.uavs[shader_type][slot] = nullptr;
+			}
+		}
+
+		// Reading or writing one of the outputs unbinds it, the common states have to be set again
+		if ((usage == HazardTracker::Usage::ShaderResource || usage == HazardTracker::Usage::UnorderedAccess) &&
+			(m_cache.states_set & PipelineStates_CommonStates) && m_cache.common_states != nullptr)
+		{
+			bool is_output{ m_cache.common_states->depth_buffer == resource };
+			for (auto i{ 0u }; i < features::max_cachable_rts; ++i)
+				is_output |= m_cache.common_states->render_targets[i] == resource;
+
+			if (is_output)
+			{
+				m_cache.pipeline_state = nullptr;
+				m_cache.states_set &= ~PipelineStates_CommonStates;
+			}
+		}
+	}
+
+	void CommandStream::_reset_cache()
+	{
+		std::memset(&m_cache, 0, sizeof(BindCache));
+		m_cache.states_set = PipelineStates_None;
+	}
+
+	const void** CommandStream::_cached_binding(const ShaderVariable& variable)
+	{
+		const auto shader_type{ variable.shader_type };
+		const auto slot{ variable.slot };
+		if (shader_type >= Shader::num_types)
+			return nullptr;
+
+		// Slots that don't fit are never cached
+		switch (static_cast<BindType>(variable.type))
+		{
+		case BindType::Sampler:
+			return slot < features::max_bindable_samplers ? &m_cache.samplers[shader_type][slot] : nullptr;
+		case BindType::Surface:
+		case BindType::Buffer:
+			if (variable.is_uav)
+				return slot < features::max_bindable_shader_resources ? &m_cache.uavs[shader_type][slot] : nullptr;
+			return slot < features::max_bindable_shader_resources ? &m_cache.resources[shader_type][slot] : nullptr;
+		case BindType::ConstantBuffer:
+			return slot < features::max_bindable_constant_buffers ? &m_cache.constants[shader_type][slot] : nullptr;
+		default:
+			return nullptr;
+		}
+	}
+}
@@ -0,0 +1,84 @@
+// Header
+#include <camy/destruction_queue.hpp>
+
+// C++ STL
+#include <iterator>
+
+namespace camy
+{
+	DestructionQueue::DestructionQueue(u32 delay) :
+		m_delay{ delay },
+		m_frame{ 0 }
+	{
+
+	}
+
+	void DestructionQueue::push(u64 size, Release&& release)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		// Tagged under the lock, entries are sorted by frame
+		m_entries.push_back({ m_frame, size, std::move(release) });
+		++m_stats.num_pending;
+		m_stats.pending_size += size;
+	}
+
+	void DestructionQueue::begin_frame()
+	{
+		std::vector<Entry> released;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			++m_frame;
+			auto num_entries{ 0u };
+			while (num_entries < m_entries.size() && m_entries[num_entries].frame + m_delay <= m_frame)
+				++num_entries;
+
+			released = _pop(num_entries);
+		}
+
+		// A release can dispose other resources, they are pushed as usual
+		for (auto& entry : released)
+			entry.release();
+	}
+
+	void DestructionQueue::flush()
+	{
+		std::vector<Entry> released;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			released = _pop(static_cast<u32>(m_entries.size()));
+		}
+
+		for (auto& entry : released)
+			entry.release();
+	}
+
+	u64 DestructionQueue::get_frame()const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_frame;
+	}
+
+	DestructionQueue::Stats DestructionQueue::get_stats()const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_stats;
+	}
+
+	std::vector<DestructionQueue::Entry> DestructionQueue::_pop(u32 num_entries)
+	{
+		std::vector<Entry> popped(std::make_move_iterator(m_entries.begin()), std::make_move_iterator(m_entries.begin() + num_entries));
+		m_entries.erase(m_entries.begin(), m_entries.begin() + num_entries);
+
+		m_stats.num_released = num_entries;
+		m_stats.released_size = 0;
+		for (const auto& entry : popped)
+			m_stats.released_size += entry.size;
+
+		m_stats.num_pending -= num_entries;
+		m_stats.pending_size -= m_stats.released_size;
+
+		return popped;
+	}
+}
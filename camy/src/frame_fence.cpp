@@ -0,0 +1,32 @@
+// Header
+#include <camy/frame_fence.hpp>
+
+namespace camy
+{
+	FrameFence::FrameFence() :
+		m_value{ 0 }
+	{
+
+	}
+
+	void FrameFence::signal(u64 value)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_value = value;
+		}
+		m_signaled.notify_all();
+	}
+
+	void FrameFence::wait(u64 value)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_signaled.wait(lock, [&]() { return m_value >= value; });
+	}
+
+	u64 FrameFence::get_value()const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_value;
+	}
+}
@@ -0,0 +1,153 @@
+// Header
+#include <camy/hazard_tracker.hpp>
+
+// C++ STL
+#include <cstring>
+
+namespace camy
+{
+	HazardTracker::HazardTracker()
+	{
+		reset();
+	}
+
+	u32 HazardTracker::find_conflicts(const void* resource, Usage usage, View* views)const
+	{
+		if (resource == nullptr)
+			return 0;
+
+		u32 num_conflicts{ 0 };
+		auto add = [&](Usage view_usage, u32 shader_type, u32 slot)
+		{
+			if (num_conflicts < max_conflicts)
+				views[num_conflicts++] = { view_usage, static_cast<u8>(shader_type), static_cast<u16>(slot) };
+		};
+
+		if (conflicts(Usage::ShaderResource, usage))
+		{
+			for (auto shader_type{ 0u }; shader_type < Shader::num_types; ++shader_type)
+			{
+				for (auto slot{ 0u }; slot < m_shader_resources_end[shader_type]; ++slot)
+				{
+					if (m_shader_resources[shader_type][slot] == resource)
+						add(Usage::ShaderResource, shader_type, slot);
+				}
+			}
+		}
+
+		if (conflicts(Usage::UnorderedAccess, usage))
+		{
+			for (auto slot{ 0u }; slot < m_unordered_access_end; ++slot)
+			{
+				if (m_unordered_access[slot] == resource)
+					add(Usage::UnorderedAccess, static_cast<u32>(Shader::Type::Compute), slot);
+			}
+		}
+
+		if (conflicts(Usage::RenderTarget, usage))
+		{
+			for (auto slot{ 0u }; slot < features::max_cachable_rts; ++slot)
+			{
+				if (m_render_targets[slot] == resource)
+					add(Usage::RenderTarget, 0, slot);
+			}
+		}
+
+		if (conflicts(Usage::DepthStencil, usage) && m_depth_buffer == resource)
+			add(Usage::DepthStencil, 0, 0);
+
+		return num_conflicts;
+	}
+
+	void HazardTracker::set(const View& view, const void* resource)
+	{
+		switch (view.usage)
+		{
+		case Usage::ShaderResource:
+			if (view.shader_type < Shader::num_types && view.slot < max_slots)
+			{
+				m_shader_resources[view.shader_type][view.slot] = resource;
+				if (resource != nullptr && view.slot >= m_shader_resources_end[view.shader_type])
+					m_shader_resources_end[view.shader_type] = view.slot + 1;
+			}
+			break;
+
+		case Usage::UnorderedAccess:
+			if (view.slot < max_slots)
+			{
+				m_unordered_access[view.slot] = resource;
+				if (resource != nullptr && view.slot >= m_unordered_access_end)
+					m_unordered_access_end = view.slot + 1;
+			}
+			break;
+
+		case Usage::RenderTarget:
+			if (view.slot < features::max_cachable_rts)
+				m_render_targets[view.slot] = resource;
+			break;
+
+		case Usage::DepthStencil:
+			m_depth_buffer = resource;
+			break;
+		}
+	}
+
+	const void* HazardTracker::get(const View& view)const
+	{
+		switch (view.usage)
+		{
+		case Usage::ShaderResource:
+			return view.shader_type < Shader::num_types && view.slot < max_slots ? m_shader_resources[view.shader_type][view.slot] : nullptr;
+		case Usage::UnorderedAccess:
+			return view.slot < max_slots ? m_unordered_access[view.slot] : nullptr;
+		case Usage::RenderTarget:
+			return view.slot < features::max_cachable_rts ? m_render_targets[view.slot] : nullptr;
+		case Usage::DepthStencil:
+			return m_depth_buffer;
+		default:
+			return nullptr;
+		}
+	}
+
+	void HazardTracker::forget(const void* resource)
+	{
+		if (resource == nullptr)
+			return;
+
+		// Every usage, there is no single one conflicting with all of them
+		for (auto shader_type{ 0u }; shader_type < Shader::num_types; ++shader_type)
+		{
+			for (auto slot{ 0u }; slot < m_shader_resources_end[shader_type]; ++slot)
+			{
+				if (m_shader_resources[shader_type][slot] == resource)
+					m_shader_resources[shader_type][slot] = nullptr;
+			}
+		}
+
+		for (auto slot{ 0u }; slot < m_unordered_access_end; ++slot)
+		{
+			if (m_unordered_access[slot] == resource)
+				m_unordered_access[slot] = nullptr;
+		}
+
+		for (auto slot{ 0u }; slot < features::max_cachable_rts; ++slot)
+		{
+			if (m_render_targets[slot] == resource)
+				m_render_targets[slot] = nullptr;
+		}
+
+		if (m_depth_buffer == resource)
+			m_depth_buffer = nullptr;
+	}
+
+	void HazardTracker::reset()
+	{
+		std::memset(m_shader_resources, 0, sizeof(m_shader_resources));
+		std::memset(m_unordered_access, 0, sizeof(m_unordered_access));
+		std::memset(m_render_targets, 0, sizeof(m_render_targets));
+		m_depth_buffer = nullptr;
+
+		std::memset(m_shader_resources_end, 0, sizeof(m_shader_resources_end));
+		m_unordered_access_end = 0;
+	}
+}
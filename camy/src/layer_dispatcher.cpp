@@ -1,127 +1,430 @@
-// Header
-#include <camy/layer_dispatcher.hpp>
-
-// camy
-#include <camy/init.hpp>
-
-// C++ STL
-#undef max
-#include <algorithm>
-
-namespace camy
-{
-	void LayerDispatcher::add_layer(Layer* layer)
-	{
-		if (layer == nullptr)
-		{
-			camy_warning("Tried to add null layer");
-			return;
-		}
-
-		m_layers.push_back(layer);
-		_validate_layers();
-
-		camy_info("New layer : pass(", layer->get_pass(), ")");
-	}
-
-	void LayerDispatcher::remove_layer(Layer* layer)
-	{
-		if (layer == nullptr)
-		{
-			camy_warning("Trying to remove null layer");
-			return;
-		}
-
-		auto result{ std::find(m_layers.begin(), m_layers.end(), layer) };
-		if (result == m_layers.end())
-		{
-			camy_error("Tried to remove a layer that does not exists");
-			return;
-		}
-		m_layers.erase(result);
-		_validate_layers();
-
-		camy_info("Removed layer : pass(", layer->get_pass(), ")");
-	}
-
-	void LayerDispatcher::dispatch()
-	{
-		m_bitmask.clear();
-		m_bitmask.resize(m_layers.size(), 0);
-		auto current_index{ 0u };
-		while (current_index < m_layers.size())
-		{
-			// Passes with no layers are automatically ignored, warning is
-			// issused by the _validate_layers() to warn the user
-			auto current_pass{ m_layers[current_index]->get_pass() };
-
-			// Trying to dispatch a layer from the current pass
-			auto i{ current_index };
-			while (i < m_layers.size() &&
-				m_layers[i]->get_order() == RenderLayer::Order::Ordered &&
-				m_layers[i]->get_pass() == current_pass && 
-				m_bitmask[i] == false)
-			{
-				if (m_layers[i]->get_state() == Layer::State::Ready || 
-					m_layers[i]->get_state() == Layer::State::Permanent)
-				{
-					if (m_layers[i]->get_type() == Layer::Type::Render)
-						hidden::gpu.execute(static_cast<const RenderLayer*>(m_layers[i]));
-					else if (m_layers[i]->get_type() == Layer::Type::Compute)
-						hidden::gpu.execute(static_cast<const ComputeLayer*>(m_layers[i]));
-					else if (m_layers[i]->get_type() == Layer::Type::PostProcess)
-						hidden::gpu.execute(static_cast<const PostProcessLayer*>(m_layers[i]));
-					m_bitmask[i] = true;
-					++i;
-				}
-			}
-
-			// Checking if all layers of current pass have been dispatched
-			bool all_dispatched{ true };
-			for (auto j{ current_index }; j < i; ++j)
-			{
-				if (m_bitmask[j] == false)
-				{
-					all_dispatched = false;
-					break;
-				}
-			}
-
-			// Moving to the next pass
-			if (all_dispatched)
-				current_index = i;
-		}
-
-		for (const auto& layer : m_layers)
-			layer->tag_executed();
-	}
-
-	void LayerDispatcher::_validate_layers()
-	{
-		// Sorting the layers by pass
-		std::sort(m_layers.begin(), m_layers.end(), [](Layer* left, Layer* right)
-		{
-			return left->get_pass() < right->get_pass();
-		});
-
-		// Making sure there are no empty spots, say that :
-		// 0 => shadow_pass
-		// 2 => forward
-		// 1 is empty, it will be skipped, but we are warning the user this is not intended behavior probably
-		// For this we only consider ordered layers
-		// If we only have between layers() warning will come out, simply add empty layers to remove them
-		auto mask{ 0u };
-		u32 max_pass{ 0u };
-		for (const auto& layer : m_layers)
-		{
-			mask |= layer->get_order() == Layer::Order::Ordered ? (1 << layer->get_pass()) : 0x0;
-			max_pass = std::max(max_pass, layer->get_pass());
-		}
-
-		for (auto i{ 0u }; i < max_pass; ++i)
-		{
-			if (!(mask & (1 << i)))
-				camy_warning("Unwanted behavior, empty render layer slot : ", std::to_string(i).c_str());
-		}
-	}
-}
\ No newline at end of file
+// Header
+#include <camy/layer_dispatcher.hpp>
+
+// camy
+#include <camy/init.hpp>
+
+// C++ STL
+#undef max
+#include <algorithm>
+
+namespace camy
+{
+	LayerDispatcher::LayerDispatcher() :
+		m_workers{ nullptr },
+		m_num_frames{ 0 },
+		m_num_submitted_frames{ 0 },
+		m_quit{ false }
+	{
+
+	}
+
+	LayerDispatcher::~LayerDispatcher()
+	{
+		set_pipelined(false);
+		delete m_workers;
+	}
+
+	void LayerDispatcher::set_pipelined(bool pipelined)
+	{
+		if (pipelined == is_pipelined())
+			return;
+
+		if (pipelined)
+		{
+			m_quit = false;
+			m_num_submitted_frames = m_num_frames;
+			m_render_thread = std::thread(&LayerDispatcher::_render_thread, this);
+			camy_info("Dispatching pipelined frames");
+			return;
+		}
+
+		// Frames in flight are replayed before quitting
+		{
+			std::lock_guard<std::mutex> lock(m_submit_mutex);
+			m_quit = true;
+		}
+		m_submitted.notify_one();
+		m_render_thread.join();
+	}
+
+	void LayerDispatcher::flush()
+	{
+		m_fence.wait(m_num_frames);
+	}
+
+	const CommandStream* LayerDispatcher::get_command_streams()const
+	{
+		if (m_num_frames == 0)
+			return nullptr;
+
+		const auto& frame{ m_frames[(m_num_frames - 1) % num_frames_in_flight] };
+		return frame.num_streams == 0 ? nullptr : &frame.streams[0];
+	}
+
+	void LayerDispatcher::set_num_workers(u32 num_workers)
+	{
+		if (num_workers == get_num_workers())
+			return;
+
+		delete m_workers;
+		m_workers = num_workers > 0 ? new WorkerPool(num_workers) : nullptr;
+		
+		camy_info("Compiling layers with: ", num_workers, " workers");
+	}
+
+	void LayerDispatcher::add_layer(Layer* layer)
+	{
+		if (layer == nullptr)
+		{
+			camy_warning("Tried to add null layer");
+			return;
+		}
+
+		if (m_layers.size() >= max_layers)
+		{
+			camy_error("Too many layers, max: ", static_cast<u32>(max_layers));
+			return;
+		}
+
+		m_layers.push_back(layer);
+		_sort_layers();
+
+		camy_info("New layer : pass(", layer->get_pass(), ")");
+	}
+
+	void LayerDispatcher::remove_layer(Layer* layer)
+	{
+		if (layer == nullptr)
+		{
+			camy_warning("Trying to remove null layer");
+			return;
+		}
+
+		auto result{ std::find(m_layers.begin(), m_layers.end(), layer) };
+		if (result == m_layers.end())
+		{
+			camy_error("Tried to remove a layer that does not exists");
+			return;
+		}
+		m_layers.erase(result);
+		_sort_layers();
+
+		camy_info("Removed layer : pass(", layer->get_pass(), ")");
+	}
+
+	void LayerDispatcher::add_output(const PipelineResource* resource)
+	{
+		if (resource == nullptr)
+		{
+			camy_warning("Tried to add null output");
+			return;
+		}
+
+		if (std::find(m_outputs.begin(), m_outputs.end(), resource) == m_outputs.end())
+			m_outputs.push_back(resource);
+	}
+
+	void LayerDispatcher::remove_output(const PipelineResource* resource)
+	{
+		auto result{ std::find(m_outputs.begin(), m_outputs.end(), resource) };
+		if (result != m_outputs.end())
+			m_outputs.erase(result);
+	}
+
+	void LayerDispatcher::dispatch(const Surface* present_surface)
+	{
+		// The slot is reused, the frame that was using it has to be done
+		auto& frame{ m_frames[m_num_frames % num_frames_in_flight] };
+		if (m_num_frames >= num_frames_in_flight)
+			m_fence.wait(m_num_frames - num_frames_in_flight + 1);
+
+		// Declarations can change at any time, rebuilding is cheap compared to the rendering itself
+		_build_graph();
+		_cull();
+		_schedule();
+
+		// Streams are kept to reuse their memory
+		const auto schedule_size{ get_schedule_size() };
+		if (frame.streams.size() < schedule_size)
+			frame.streams.resize(schedule_size);
+		frame.num_streams = schedule_size;
+
+		auto compile = [this, &frame](u32 schedule_index, u32 thread_index)
+		{
+			_compile(schedule_index, frame.streams[schedule_index]);
+		};
+
+		if (m_workers != nullptr)
+			m_workers->run(schedule_size, compile);
+		else
+		{
+			for (auto i{ 0u }; i < schedule_size; ++i)
+				compile(i, 0);
+		}
+
+		frame.commands.swap(m_frame_commands);
+		m_frame_commands.clear();
+		frame.present_surface = present_surface;
+
+		// Culled layers are reset too, otherwise they couldn't begin() the next frame. The streams
+		// don't reference the layers, they can be recorded again right away
+		for (const auto& layer : m_layers)
+			layer->tag_executed();
+
+		++m_num_frames;
+
+		if (is_pipelined())
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_submit_mutex);
+				m_num_submitted_frames = m_num_frames;
+			}
+			m_submitted.notify_one();
+			return;
+		}
+
+		_replay(frame);
+		m_fence.signal(m_num_frames);
+	}
+
+	void LayerDispatcher::_replay(const Frame& frame)
+	{
+		// Replaying has to be serial, there is only one context. Resources disposed frames in flight ago are
+		// released and pending uploads go first, on the same thread
+		hidden::gpu.begin_frame();
+		hidden::gpu.process_uploads();
+		hidden::gpu.execute(frame.commands);
+		for (auto i{ 0u }; i < frame.num_streams; ++i)
+			hidden::gpu.execute(frame.streams[i]);
+
+		if (frame.present_surface != nullptr)
+			hidden::gpu.swap_buffers(frame.present_surface);
+	}
+
+	void LayerDispatcher::_render_thread()
+	{
+		auto num_replayed_frames{ m_fence.get_value() };
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_submit_mutex);
+				m_submitted.wait(lock, [&]() { return m_quit || m_num_submitted_frames > num_replayed_frames; });
+				if (m_num_submitted_frames <= num_replayed_frames)
+					return;
+			}
+
+			_replay(m_frames[num_replayed_frames % num_frames_in_flight]);
+			m_fence.signal(++num_replayed_frames);
+		}
+	}
+
+	void LayerDispatcher::_sort_layers()
+	{
+		// Pass order is the reference order for conflicting accesses, stable to make the insertion
+		// order the tie breaker in the same pass
+		std::stable_sort(m_layers.begin(), m_layers.end(), [](Layer* left, Layer* right)
+		{
+			return left->get_pass() < right->get_pass();
+		});
+	}
+
+	void LayerDispatcher::_build_graph()
+	{
+		const auto num_layers{ static_cast<u32>(m_layers.size()) };
+		m_nodes.resize(num_layers);
+
+		for (auto i{ 0u }; i < num_layers; ++i)
+		{
+			auto& node{ m_nodes[i] };
+			const auto layer{ m_layers[i] };
+
+			node.successors = 0;
+			node.consumers = 0;
+			node.num_predecessors = 0;
+			node.is_alive = false;
+			node.target = nullptr;
+
+			// Without writes the effects of the layer are unknown
+			bool has_writes{ false };
+			bool writes_output{ false };
+			for (auto r{ 0u }; r < layer->get_num_resources(); ++r)
+			{
+				const auto& access{ layer->get_resources()[r] };
+				if (!access.write)
+					continue;
+
+				has_writes = true;
+
+				if (node.target == nullptr && access.resource->type == BindType::Surface)
+					node.target = access.resource;
+
+				if (std::find(m_outputs.begin(), m_outputs.end(), access.resource) != m_outputs.end())
+					writes_output = true;
+			}
+
+			node.is_root = !has_writes || writes_output;
+		}
+
+		// Edges always go from a lower to an higher index, this way the graph can't have cycles
+		for (auto i{ 0u }; i < num_layers; ++i)
+		{
+			const auto first{ m_layers[i] };
+			for (auto j{ i + 1 }; j < num_layers; ++j)
+			{
+				const auto second{ m_layers[j] };
+				const u64 bit{ 1ull << j };
+
+				if (!first->has_declared_resources() || !second->has_declared_resources())
+				{
+					// Barriers, the same old pass ordering
+					if (first->get_order() == Layer::Order::Ordered && second->get_order() == Layer::Order::Ordered &&
+						first->get_pass() < second->get_pass())
+					{
+						m_nodes[i].successors |= bit;
+						m_nodes[i].consumers |= bit;
+					}
+					continue;
+				}
+
+				for (auto r{ 0u }; r < first->get_num_resources(); ++r)
+				{
+					const auto& access{ first->get_resources()[r] };
+
+					// Write before read / write => second consumes first
+					if (access.write && (_reads(second, access.resource) || _writes(second, access.resource)))
+					{
+						m_nodes[i].successors |= bit;
+						m_nodes[i].consumers |= bit;
+						break;
+					}
+
+					// Read before write, ordering only
+					if (!access.write && _writes(second, access.resource))
+						m_nodes[i].successors |= bit;
+				}
+			}
+		}
+	}
+
+	void LayerDispatcher::_cull()
+	{
+		// Consumers always have an higher index, walking backwards they have already been visited
+		for (auto i{ static_cast<i32>(m_nodes.size()) - 1 }; i >= 0; --i)
+		{
+			auto& node{ m_nodes[i] };
+			node.is_alive = node.is_root;
+
+			for (auto j{ static_cast<u32>(i) + 1 }; j < m_nodes.size() && !node.is_alive; ++j)
+			{
+				if ((node.consumers & (1ull << j)) && m_nodes[j].is_alive)
+					node.is_alive = true;
+			}
+		}
+
+		for (auto i{ 0u }; i < m_nodes.size(); ++i)
+		{
+			if (!m_nodes[i].is_alive)
+				continue;
+
+			for (auto j{ i + 1 }; j < m_nodes.size(); ++j)
+			{
+				if ((m_nodes[i].successors & (1ull << j)) && m_nodes[j].is_alive)
+					++m_nodes[j].num_predecessors;
+			}
+		}
+	}
+
+	void LayerDispatcher::_schedule()
+	{
+		m_schedule.clear();
+		m_schedule_nodes.clear();
+
+		u64 ready{ 0 };
+		for (auto i{ 0u }; i < m_nodes.size(); ++i)
+		{
+			if (m_nodes[i].is_alive && m_nodes[i].num_predecessors == 0)
+				ready |= 1ull << i;
+		}
+
+		const PipelineResource* current_target{ nullptr };
+		while (ready != 0)
+		{
+			// Lowest index ( pass order ) unless some layer can keep rendering to the current target
+			auto next{ 0u };
+			while (!(ready & (1ull << next)))
+				++next;
+
+			if (m_nodes[next].target != current_target && current_target != nullptr)
+			{
+				for (auto i{ next + 1 }; i < m_nodes.size(); ++i)
+				{
+					if ((ready & (1ull << i)) && m_nodes[i].target == current_target)
+					{
+						next = i;
+						break;
+					}
+				}
+			}
+
+			ready &= ~(1ull << next);
+			m_schedule.push_back(m_layers[next]);
+			m_schedule_nodes.push_back(next);
+
+			// Compute layers don't touch the render targets
+			if (m_nodes[next].target != nullptr)
+				current_target = m_nodes[next].target;
+
+			for (auto j{ next + 1 }; j < m_nodes.size(); ++j)
+			{
+				if ((m_nodes[next].successors & (1ull << j)) && m_nodes[j].is_alive && --m_nodes[j].num_predecessors == 0)
+					ready |= 1ull << j;
+			}
+		}
+	}
+
+	void LayerDispatcher::_compile(u32 schedule_index, CommandStream& stream)
+	{
+		const auto layer{ m_schedule[schedule_index] };
+
+		// Nothing has been queued, still the dependent layers are executed
+		if (layer->get_state() == Layer::State::Queueing)
+			camy_warning("Skipping layer that is still queueing, end() has not been called : pass(", layer->get_pass(), ")");
+
+		if (layer->get_state() != Layer::State::Ready &&
+			layer->get_state() != Layer::State::Permanent)
+		{
+			stream.clear();
+			return;
+		}
+
+		if (layer->get_type() == Layer::Type::Render)
+			stream.compile(*static_cast<const RenderLayer*>(layer));
+		else if (layer->get_type() == Layer::Type::Compute)
+			stream.compile(*static_cast<const ComputeLayer*>(layer));
+		else if (layer->get_type() == Layer::Type::PostProcess)
+			stream.compile(*static_cast<const PostProcessLayer*>(layer));
+		else
+			stream.clear();
+	}
+
+	bool LayerDispatcher::_writes(const Layer* layer, const PipelineResource* resource)const
+	{
+		for (auto r{ 0u }; r < layer->get_num_resources(); ++r)
+		{
+			if (layer->get_resources()[r].write && layer->get_resources()[r].resource == resource)
+				return true;
+		}
+		return false;
+	}
+
+	bool LayerDispatcher::_reads(const Layer* layer, const PipelineResource* resource)const
+	{
+		for (auto r{ 0u }; r < layer->get_num_resources(); ++r)
+		{
+			if (!layer->get_resources()[r].write && layer->get_resources()[r].resource == resource)
+				return true;
+		}
+		return false;
+	}
+}
@@ -1,196 +1,303 @@
-// Header
-#include <camy/layers.hpp>
-
-// camy
-#include <camy/queue.hpp>
-
-namespace camy
-{
-	RenderLayer::RenderLayer(Order order, u32 pass, u32 num_render_queues, u32 queue_size_estimate) :
-		Layer::Layer(Type::Render, order, pass),
-
-		m_render_queues{ nullptr },
-		m_num_render_queues{ num_render_queues }
-	{
-		m_render_queues = new Queue<RenderItem>[m_num_render_queues];
-	}
-
-	RenderLayer::~RenderLayer()
-	{
-		safe_release_array(m_render_queues);
-	}
-
-	void RenderLayer::begin()
-	{
-		if (m_state == State::Queueing)
-		{
-			camy_warning("Can't called begin multiple times");
-			return;
-		}
-
-		if (m_state == State::Ready)
-		{
-			camy_warning("Can't call begin while the items have yet to be executed");
-			return;
-		}
-
-		for (auto i{ 0u }; i < m_num_render_queues; ++i)
-			m_render_queues[i].begin();
-
-		m_state = State::Queueing;
-	}
-
-	RenderItem* RenderLayer::create_render_item(u32 render_queue)
-	{
-		camy_assert(render_queue < m_num_render_queues, { return; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
-
-		return m_render_queues[render_queue].create_item();
-	}
-
-	void RenderLayer::end(u32 render_queue, const ParameterGroup* shared_parameters, Dependency* dependencies, const u32 num_dependencies)
-	{
-		if (m_state == State::Executed)
-		{
-			camy_warning("Can't call end() before begin() has been called") ;
-			return;
-		}
-
-		if (m_state == State::Ready)
-		{
-			camy_warning("End on all the render queues hasnt been called");
-			return;
-		}
-
-		camy_assert(render_queue < m_num_render_queues, { return; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
-
-		m_render_queues[render_queue].end(shared_parameters, dependencies, num_dependencies);
-
-		bool all_ready{ true };
-		for (auto i{ 0u }; i < m_num_render_queues; ++i)
-		{
-			if (m_render_queues[i].get_state() != Queue<RenderItem>::State::Ready)
-			{
-				all_ready = false;
-				break;
-			}
-		}
-
-		if (all_ready)
-			m_state = State::Ready;
-	}
-
-	void RenderLayer::tag_executed()
-	{
-		for (auto i{ 0u }; i < m_num_render_queues; ++i)
-		{
-			m_render_queues[i].tag_executed();
-			if (m_render_queues[i].get_state() != Queue<RenderItem>::State::Executed)
-			{
-				camy_warning("Failed to tag queue as executed");
-				return;
-			}
-		}
-
-		m_state = State::Executed;
-	}
-
-	ComputeLayer::ComputeLayer(Order order, u32 pass) :
-		Layer::Layer(Type::Compute, order, pass)
-	{
-
-	}
-
-	void ComputeLayer::begin()
-	{
-		if (m_state == State::Queueing)
-		{
-			camy_warning("Can't called begin multiple times");
-			return;
-		}
-
-		if (m_state == State::Ready)
-		{
-			camy_warning("Can't call begin while the items have yet to be executed");
-			return;
-		}
-
-		m_queue.begin();
-	
-		m_state = State::Queueing;
-	}
-
-	ComputeItem* ComputeLayer::create_compute_item()
-	{	
-		return m_queue.create_item();
-	}
-
-	void ComputeLayer::end()
-	{
-		if (m_state == State::Executed)
-		{
-			camy_warning("Can't call end() before begin() has been called");
-			return;
-		}
-
-		if (m_state == State::Ready)
-		{
-			camy_warning("End on all the computes queues hasnt been called");
-			return;
-		}
-
-		m_queue.end();
-		m_state = State::Ready;
-	}
-
-	const Queue<ComputeItem>* ComputeLayer::get_queue()const
-	{
-		return &m_queue;
-	}
-
-	void ComputeLayer::tag_executed()
-	{
-		m_queue.tag_executed();
-		if (m_queue.get_state() != Queue<ComputeItem>::State::Executed)
-			camy_warning("Failed to tag the compute queue as executed");
-		else
-			m_state = State::Executed;
-	}
-
-	PostProcessLayer::PostProcessLayer(Order order, u32 pass) :
-		Layer::Layer(Type::PostProcess, order, pass),
-		m_items{ nullptr },
-		m_num_items{ 0u }
-	{
-		// Postprocess is always ready
-		m_state = State::Permanent;
-	}
-
-	PostProcessLayer::~PostProcessLayer()
-	{
-		safe_release_array(m_items);
-	}
-
-	void PostProcessLayer::create(const PostProcessItem* items, u32 num_items)
-	{
-		if (num_items == 0)
-		{
-			camy_warning("Void call, number of postprocess items is set to 0");
-			return;
-		}
-
-		safe_release_array(m_items);
-	
-		m_items = new PostProcessItem[num_items];
-		std::memcpy(m_items, items, sizeof(PostProcessItem) * num_items);
-		m_num_items = num_items;
-	}
-
-	void PostProcessLayer::set_shared_parameters(const ParameterGroup& parameters)
-	{
-		m_shared_parameters = parameters;
-	}
-
-	void PostProcessLayer::tag_executed()
-	{
-	}
+// Header
+#include <camy/layers.hpp>
+
+// camy
+#include <camy/queue.hpp>
+
+namespace camy
+{
+	void Layer::reads(const PipelineResource* resource)
+	{
+		if (resource == nullptr)
+		{
+			camy_warning("Tried to declare a read of a null resource");
+			return;
+		}
+
+		ResourceAccess access;
+		access.resource = resource;
+		access.write = false;
+		m_resources.push_back(access);
+	}
+
+	void Layer::writes(const PipelineResource* resource)
+	{
+		if (resource == nullptr)
+		{
+			camy_warning("Tried to declare a write to a null resource");
+			return;
+		}
+
+		ResourceAccess access;
+		access.resource = resource;
+		access.write = true;
+		m_resources.push_back(access);
+	}
+
+	RenderLayer::RenderLayer(Order order, u32 pass, u32 num_render_queues, u32 queue_size_estimate) :
+		Layer::Layer(Type::Render, order, pass),
+
+		m_render_queues{ nullptr },
+		m_num_render_queues{ num_render_queues },
+		m_instance_data_size{ 0 }
+	{
+		m_render_queues = new Queue<RenderItem>[m_num_render_queues];
+	}
+
+	RenderLayer::~RenderLayer()
+	{
+		safe_release_array(m_render_queues);
+	}
+
+	void RenderLayer::begin()
+	{
+		if (m_state == State::Queueing)
+		{
+			camy_warning("Can't called begin multiple times");
+			return;
+		}
+
+		if (m_state == State::Ready)
+		{
+			camy_warning("Can't call begin while the items have yet to be executed");
+			return;
+		}
+
+		for (auto i{ 0u }; i < m_num_render_queues; ++i)
+			m_render_queues[i].begin();
+
+		m_state = State::Queueing;
+	}
+
+	RenderItem* RenderLayer::create_render_item(u32 render_queue, RenderItem::Key key)
+	{
+		camy_assert(render_queue < m_num_render_queues, { return; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
+
+		return m_render_queues[render_queue].create_item(key);
+	}
+
+	void RenderLayer::set_render_item_key(u32 render_queue, RenderItem* render_item, RenderItem::Key key)
+	{
+		camy_assert(render_queue < m_num_render_queues, { return; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
+
+		m_render_queues[render_queue].set_key(render_item, key);
+	}
+
+	void RenderLayer::set_retained(bool retained)
+	{
+		for (auto i{ 0u }; i < m_num_render_queues; ++i)
+			m_render_queues[i].set_retained(retained);
+	}
+
+	void RenderLayer::set_max_items(u32 max_items)
+	{
+		for (auto i{ 0u }; i < m_num_render_queues; ++i)
+			m_render_queues[i].set_max_items(max_items);
+	}
+
+	RenderLayer::ItemHandle RenderLayer::add_render_item(u32 render_queue, RenderItem::Key key)
+	{
+		camy_assert(render_queue < m_num_render_queues, { return Queue<RenderItem>::invalid_handle; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
+
+		return m_render_queues[render_queue].add_item(key);
+	}
+
+	RenderItem* RenderLayer::get_render_item(u32 render_queue, ItemHandle handle)
+	{
+		camy_assert(render_queue < m_num_render_queues, { return nullptr; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
+
+		return m_render_queues[render_queue].get_item(handle);
+	}
+
+	void RenderLayer::set_render_item_key(u32 render_queue, ItemHandle handle, RenderItem::Key key)
+	{
+		camy_assert(render_queue < m_num_render_queues, { return; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
+
+		m_render_queues[render_queue].set_key(handle, key);
+	}
+
+	void RenderLayer::remove_render_item(u32 render_queue, ItemHandle handle)
+	{
+		camy_assert(render_queue < m_num_render_queues, { return; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
+
+		m_render_queues[render_queue].remove_item(handle);
+	}
+
+	RenderLayer::Recorder RenderLayer::create_recorder(u32 thread_index)
+	{
+		if (thread_index >= Queue<RenderItem>::max_recorders)
+		{
+			camy_error("Thread index: ", thread_index, " is out of range, max recorders: ", static_cast<u32>(Queue<RenderItem>::max_recorders));
+			return Recorder();
+		}
+
+		return Recorder(this, thread_index);
+	}
+
+	RenderItem* RenderLayer::Recorder::create_render_item(u32 render_queue, RenderItem::Key key)
+	{
+		camy_assert(m_layer != nullptr && render_queue < m_layer->m_num_render_queues, { return nullptr; }, "Invalid recorder or render queue | ", render_queue);
+
+		return m_layer->m_render_queues[render_queue].create_recorder(m_thread_index).create_item(key);
+	}
+
+	void RenderLayer::Recorder::set_render_item_key(u32 render_queue, RenderItem* render_item, RenderItem::Key key)
+	{
+		camy_assert(m_layer != nullptr && render_queue < m_layer->m_num_render_queues, { return; }, "Invalid recorder or render queue | ", render_queue);
+
+		m_layer->m_render_queues[render_queue].create_recorder(m_thread_index).set_key(render_item, key);
+	}
+
+	void RenderLayer::set_reorder_items(bool reorder_items)
+	{
+		for (auto i{ 0u }; i < m_num_render_queues; ++i)
+			m_render_queues[i].set_reorder_items(reorder_items);
+	}
+
+	void RenderLayer::end(u32 render_queue, const ParameterGroup* shared_parameters, Dependency* dependencies, const u32 num_dependencies)
+	{
+		if (m_state == State::Executed)
+		{
+			camy_warning("Can't call end() before begin() has been called") ;
+			return;
+		}
+
+		if (m_state == State::Ready)
+		{
+			camy_warning("End on all the render queues hasnt been called");
+			return;
+		}
+
+		camy_assert(render_queue < m_num_render_queues, { return; }, "Render queue does not identify a valid render queue in the current pass | ", render_queue);
+
+		m_render_queues[render_queue].end(shared_parameters, dependencies, num_dependencies);
+
+		bool all_ready{ true };
+		for (auto i{ 0u }; i < m_num_render_queues; ++i)
+		{
+			if (m_render_queues[i].get_state() != Queue<RenderItem>::State::Ready)
+			{
+				all_ready = false;
+				break;
+			}
+		}
+
+		if (all_ready)
+			m_state = State::Ready;
+	}
+
+	void RenderLayer::tag_executed()
+	{
+		for (auto i{ 0u }; i < m_num_render_queues; ++i)
+		{
+			m_render_queues[i].tag_executed();
+			if (m_render_queues[i].get_state() != Queue<RenderItem>::State::Executed)
+			{
+				camy_warning("Failed to tag queue as executed");
+				return;
+			}
+		}
+
+		m_state = State::Executed;
+	}
+
+	ComputeLayer::ComputeLayer(Order order, u32 pass) :
+		Layer::Layer(Type::Compute, order, pass)
+	{
+
+	}
+
+	void ComputeLayer::begin()
+	{
+		if (m_state == State::Queueing)
+		{
+			camy_warning("Can't called begin multiple times");
+			return;
+		}
+
+		if (m_state == State::Ready)
+		{
+			camy_warning("Can't call begin while the items have yet to be executed");
+			return;
+		}
+
+		m_queue.begin();
+	
+		m_state = State::Queueing;
+	}
+
+	ComputeItem* ComputeLayer::create_compute_item(ComputeItem::Key key)
+	{	
+		return m_queue.create_item(key);
+	}
+
+	void ComputeLayer::end()
+	{
+		if (m_state == State::Executed)
+		{
+			camy_warning("Can't call end() before begin() has been called");
+			return;
+		}
+
+		if (m_state == State::Ready)
+		{
+			camy_warning("End on all the computes queues hasnt been called");
+			return;
+		}
+
+		m_queue.end();
+		m_state = State::Ready;
+	}
+
+	const Queue<ComputeItem>* ComputeLayer::get_queue()const
+	{
+		return &m_queue;
+	}
+
+	void ComputeLayer::tag_executed()
+	{
+		m_queue.tag_executed();
+		if (m_queue.get_state() != Queue<ComputeItem>::State::Executed)
+			camy_warning("Failed to tag the compute queue as executed");
+		else
+			m_state = State::Executed;
+	}
+
+	PostProcessLayer::PostProcessLayer(Order order, u32 pass) :
+		Layer::Layer(Type::PostProcess, order, pass),
+		m_items{ nullptr },
+		m_num_items{ 0u }
+	{
+		// Postprocess is always ready
+		m_state = State::Permanent;
+	}
+
+	PostProcessLayer::~PostProcessLayer()
+	{
+		safe_release_array(m_items);
+	}
+
+	void PostProcessLayer::create(const PostProcessItem* items, u32 num_items)
+	{
+		if (num_items == 0)
+		{
+			camy_warning("Void call, number of postprocess items is set to 0");
+			return;
+		}
+
+		safe_release_array(m_items);
+	
+		m_items = new PostProcessItem[num_items];
+		std::memcpy(m_items, items, sizeof(PostProcessItem) * num_items);
+		m_num_items = num_items;
+	}
+
+	void PostProcessLayer::set_shared_parameters(const ParameterGroup& parameters)
+	{
+		m_shared_parameters = parameters;
+	}
+
+	void PostProcessLayer::tag_executed()
+	{
+	}
 }
\ No newline at end of file
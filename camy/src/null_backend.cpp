@@ -0,0 +1,602 @@
+// Header
+#include <camy/gpu_backend.hpp>
+
+#if defined(camy_backend_null)
+
+// camy
+#include <camy/error.hpp>
+#include <camy/resources.hpp>
+#include <camy/features.hpp>
+
+// C++ STL
+#include <cstring>
+
+/*
+	Null backend, see GPUBackend. Resources are allocated from the same storer as the D3D11 ones
+	and carry the same descriptions, the handles are left null. No device is created but the 
+	build still requires the Windows SDK ( see camy_backend_null in config.hpp )
+*/
+namespace camy
+{
+	namespace
+	{
+		// There is no window to query, window surfaces are given a fixed size
+		const u32 null_window_width{ 1920 };
+		const u32 null_window_height{ 1080 };
+	}
+
+	GPUBackend::GPUBackend() :
+		m_trace_commands{ false }
+	{
+		reset_bound_state();
+	}
+
+	GPUBackend::~GPUBackend()
+	{
+		close();
+	}
+
+	bool GPUBackend::open(u32 adapter_index_ignored)
+	{
+		camy_info("Adapter in use : null backend");
+
+		reset_trace();
+		reset_bound_state();
+
+		return create_builtin_resources();
+	}
+
+	bool GPUBackend::create_builtin_resources()
+	{
+		// The fullscreen vertex shader and the instance stream don't exist here, nothing is drawn
+		return true;
+	}
+
+	void GPUBackend::close()
+	{
+		m_destruction.flush();
+		m_pipeline_states.clear();
+		clear_state_objects();
+		m_uploads.clear();
+		m_hazards.reset();
+		m_trace_entries.clear();
+	}
+
+	void GPUBackend::reset_trace()
+	{
+		m_trace = Trace();
+		m_trace_entries.clear();
+	}
+
+	void GPUBackend::trace(CommandType type, bool redundant, u32 size)
+	{
+		++m_trace.num_commands;
+
+		if (m_trace_commands)
+			m_trace_entries.push_back({ type, redundant, size });
+	}
+
+	void GPUBackend::reset_bound_state()
+	{
+		std::memset(&m_bound, 0, sizeof(BoundState));
+		m_bound.default_common_states = true;
+		m_bound.states_set = PipelineStates_None;
+	}
+
+	const void** GPUBackend::bound_parameter(const ShaderVariable& variable)
+	{
+		if (variable.shader_type >= Shader::num_types || variable.slot >= features::max_bindable_shader_resources)
+			return nullptr;
+
+		return &m_bound.parameters[variable.shader_type][variable.type][variable.is_uav][variable.slot];
+	}
+
+	void GPUBackend::execute(const CommandStream& stream)
+	{
+		// A single map of the upload ring per stream
+		if (stream.get_constant_data_size() > 0)
+		{
+			++m_trace.num_cbuffer_uploads;
+			m_trace.cbuffer_upload_size += stream.get_constant_data_size();
+		}
+
+		for (auto command{ stream.get_first() }; command != nullptr; command = stream.get_next(command))
+		{
+			switch (command->type)
+			{
+			case CommandType::SetCommonStates:
+			{
+				auto set_cs{ static_cast<const SetCommonStatesCommand*>(command) };
+
+				bool redundant{ false };
+				if (m_bound.states_set & PipelineStates_CommonStates)
+				{
+					if (set_cs->use_defaults)
+						redundant = m_bound.default_common_states;
+					else
+						redundant = !m_bound.default_common_states && std::memcmp(&m_bound.common_states, &set_cs->common_states, sizeof(CommonStates)) == 0;
+				}
+
+				if (set_cs->use_defaults)
+				{
+					const Surface* render_targets[features::max_cachable_rts]{ nullptr, nullptr };
+					set_outputs(render_targets, nullptr);
+				}
+				else if (set_cs->changed_parts & CommonStatesParts_Outputs)
+					set_outputs(set_cs->common_states.render_targets, set_cs->common_states.depth_buffer);
+
+				m_bound.default_common_states = set_cs->use_defaults != 0;
+				if (!set_cs->use_defaults)
+					m_bound.common_states = set_cs->common_states;
+				m_bound.states_set |= PipelineStates_CommonStates;
+
+				++m_trace.num_state_binds;
+				m_trace.num_redundant_state_binds += redundant;
+				trace(command->type, redundant);
+				break;
+			}
+
+			case CommandType::SetVertexBuffer:
+			{
+				auto set_vb{ static_cast<const SetVertexBufferCommand*>(command) };
+				const u32 state{ set_vb->slot == 0 ? PipelineStates_VertexBuffer1 : PipelineStates_VertexBuffer2 };
+
+				const bool redundant{ (m_bound.states_set & state) && m_bound.vertex_buffers[set_vb->slot] == set_vb->vertex_buffer };
+				m_bound.vertex_buffers[set_vb->slot] = set_vb->vertex_buffer;
+				m_bound.states_set |= state;
+
+				++m_trace.num_state_binds;
+				m_trace.num_redundant_state_binds += redundant;
+				trace(command->type, redundant);
+				break;
+			}
+
+			case CommandType::SetIndexBuffer:
+			{
+				auto index_buffer{ static_cast<const SetIndexBufferCommand*>(command)->index_buffer };
+
+				const bool redundant{ (m_bound.states_set & PipelineStates_IndexBuffer) && m_bound.index_buffer == index_buffer };
+				m_bound.index_buffer = index_buffer;
+				m_bound.states_set |= PipelineStates_IndexBuffer;
+
+				++m_trace.num_state_binds;
+				m_trace.num_redundant_state_binds += redundant;
+				trace(command->type, redundant);
+				break;
+			}
+
+			case CommandType::SetPrimitiveTopology:
+			{
+				auto primitive_topology{ static_cast<const SetPrimitiveTopologyCommand*>(command)->primitive_topology };
+
+				const bool redundant{ (m_bound.states_set & PipelineStates_PrimitiveTopology) && m_bound.primitive_topology == primitive_topology };
+				m_bound.primitive_topology = primitive_topology;
+				m_bound.states_set |= PipelineStates_PrimitiveTopology;
+
+				++m_trace.num_state_binds;
+				m_trace.num_redundant_state_binds += redundant;
+				trace(command->type, redundant);
+				break;
+			}
+
+			case CommandType::SetShader:
+			{
+				static const u32 shader_states[Shader::num_types]{ PipelineStates_VertexShader, PipelineStates_GeometryShader, PipelineStates_PixelShader, PipelineStates_ComputeShader };
+
+				auto set_shader{ static_cast<const SetShaderCommand*>(command) };
+				const auto type_index{ static_cast<u32>(set_shader->shader_type) };
+
+				const bool redundant{ (m_bound.states_set & shader_states[type_index]) && m_bound.shaders[type_index] == set_shader->shader };
+				m_bound.shaders[type_index] = set_shader->shader;
+				m_bound.states_set |= shader_states[type_index];
+
+				++m_trace.num_state_binds;
+				m_trace.num_redundant_state_binds += redundant;
+				trace(command->type, redundant);
+				break;
+			}
+
+			case CommandType::SetInstanceStream:
+				++m_trace.num_state_binds;
+				trace(command->type, false);
+				break;
+
+			case CommandType::BindRange:
+			{
+				auto range{ static_cast<const BindRangeCommand*>(command) };
+
+				bool redundant{ true };
+				for (auto i{ 0u }; i < range->num_parameters; ++i)
+				{
+					const auto& parameter{ range->get_parameters()[i] };
+
+					if (range->range_type != BindRangeType::Sampler)
+					{
+						const auto usage{ range->range_type == BindRangeType::UnorderedAccess ? HazardTracker::Usage::UnorderedAccess : HazardTracker::Usage::ShaderResource };
+						resolve_hazards(parameter.data, usage);
+						m_hazards.set({ usage, static_cast<u8>(range->shader_type), static_cast<u16>(range->first_slot + i) }, parameter.data);
+					}
+
+					auto bound{ bound_parameter(parameter.shader_variable) };
+					if (bound == nullptr || *bound != parameter.data)
+						redundant = false;
+					if (bound != nullptr)
+						*bound = parameter.data;
+				}
+
+				++m_trace.num_parameter_binds;
+				m_trace.num_redundant_parameter_binds += redundant;
+				m_trace.num_bound_parameters += range->num_parameters;
+				trace(command->type, redundant);
+				break;
+			}
+
+			case CommandType::UploadConstants:
+			{
+				// Bound by offset, the data has already been uploaded
+				const u32 size{ static_cast<const UploadConstantsCommand*>(command)->shader_variable.size };
+
+				++m_trace.num_cbuffer_binds;
+				trace(command->type, false, size);
+				break;
+			}
+
+			case CommandType::Unbind:
+				unbind(static_cast<const UnbindCommand*>(command)->dependency);
+				break;
+
+			case CommandType::UnbindOutputs:
+			{
+				const Surface* render_targets[features::max_cachable_rts]{ nullptr, nullptr };
+				set_outputs(render_targets, nullptr);
+
+				m_bound.default_common_states = true;
+				m_bound.states_set |= PipelineStates_CommonStates;
+
+				++m_trace.num_unbinds;
+				trace(command->type, false);
+				break;
+			}
+
+			case CommandType::ClearSurface:
+				++m_trace.num_clears;
+				trace(command->type, false);
+				break;
+
+			case CommandType::UpdateBuffer:
+			{
+				const auto size{ static_cast<const UpdateBufferCommand*>(command)->data_size };
+
+				++m_trace.num_buffer_updates;
+				m_trace.buffer_update_size += size;
+				trace(command->type, false, size);
+				break;
+			}
+
+			case CommandType::Draw:
+			{
+				const auto& draw_info{ static_cast<const DrawCommand*>(command)->draw_info };
+
+				++m_trace.num_draws;
+				++m_trace.num_instances;
+				m_trace.num_indices += draw_info.index_count;
+				trace(command->type, false);
+				break;
+			}
+
+			case CommandType::DrawInstanced:
+			{
+				auto draw{ static_cast<const DrawInstancedCommand*>(command) };
+				const auto size{ draw->num_instances * draw->instance_data_size };
+
+				++m_trace.num_draws;
+				m_trace.num_instances += draw->num_instances;
+				m_trace.num_indices += static_cast<u64>(draw->draw_info.index_count) * draw->num_instances;
+				m_trace.instance_upload_size += size;
+				trace(command->type, false, size);
+				break;
+			}
+
+			case CommandType::Dispatch:
+				++m_trace.num_dispatches;
+				trace(command->type, false);
+				break;
+
+			case CommandType::PostProcess:
+			{
+				auto pp{ static_cast<const PostProcessCommand*>(command) };
+
+				const Surface* render_targets[features::max_cachable_rts]{ pp->output_surface, nullptr };
+				set_outputs(render_targets, nullptr);
+				resolve_hazards(pp->input_surface, HazardTracker::Usage::ShaderResource);
+				m_hazards.set({ HazardTracker::Usage::ShaderResource, static_cast<u8>(Shader::Type::Pixel), 0 }, pp->input_surface);
+
+				// Binds its own shaders, target and input
+				m_bound.states_set &= ~(PipelineStates_CommonStates | PipelineStates_VertexShader | PipelineStates_PixelShader);
+				m_bound.parameters[static_cast<u32>(Shader::Type::Pixel)][static_cast<u32>(BindType::Surface)][0][0] = pp->input_surface;
+
+				++m_trace.num_draws;
+				++m_trace.num_instances;
+				m_trace.num_indices += 3;
+				trace(command->type, false);
+				break;
+			}
+
+			default:
+				camy_error("Unknown command in stream: ", static_cast<u32>(command->type));
+				return;
+			}
+		}
+	}
+
+	void GPUBackend::set_outputs(const Surface* const* render_targets, const Surface* depth_buffer)
+	{
+		for (auto i{ 0u }; i < features::max_cachable_rts; ++i)
+		{
+			resolve_hazards(render_targets[i], HazardTracker::Usage::RenderTarget);
+			m_hazards.set({ HazardTracker::Usage::RenderTarget, 0, static_cast<u16>(i) }, render_targets[i]);
+		}
+
+		resolve_hazards(depth_buffer, HazardTracker::Usage::DepthStencil);
+		m_hazards.set({ HazardTracker::Usage::DepthStencil, 0, 0 }, depth_buffer);
+	}
+
+	void GPUBackend::unbind_view(const HazardTracker::View& view)
+	{
+		switch (view.usage)
+		{
+		case HazardTracker::Usage::ShaderResource:
+		case HazardTracker::Usage::UnorderedAccess:
+		{
+			if (view.shader_type >= Shader::num_types || view.slot >= features::max_bindable_shader_resources)
+				break;
+
+			// Surfaces and buffers share the slots
+			const auto is_uav{ view.usage == HazardTracker::Usage::UnorderedAccess };
+			m_bound.parameters[view.shader_type][static_cast<u32>(BindType::Surface)][is_uav][view.slot] = nullptr;
+			m_bound.parameters[view.shader_type][static_cast<u32>(BindType::Buffer)][is_uav][view.slot] = nullptr;
+			break;
+		}
+
+		// The bound outputs don't match the common states anymore
+		case HazardTracker::Usage::RenderTarget:
+		case HazardTracker::Usage::DepthStencil:
+			m_bound.states_set &= ~PipelineStates_CommonStates;
+			break;
+		}
+
+		++m_trace.num_hazard_unbinds;
+		trace(CommandType::Unbind, false);
+	}
+
+	void GPUBackend::unbind(const Dependency& dependency)
+	{
+		auto bound{ bound_parameter(dependency) };
+		if (bound != nullptr)
+			*bound = nullptr;
+
+		const auto usage{ dependency.is_uav && dependency.shader_type == static_cast<u32>(Shader::Type::Compute) ? HazardTracker::Usage::UnorderedAccess : HazardTracker::Usage::ShaderResource };
+		m_hazards.set({ usage, static_cast<u8>(dependency.shader_type), static_cast<u16>(dependency.slot) }, nullptr);
+
+		++m_trace.num_unbinds;
+		trace(CommandType::Unbind, false);
+	}
+
+	void GPUBackend::unbind_outputs()
+	{
+		m_bound.default_common_states = true;
+		m_bound.states_set |= PipelineStates_CommonStates;
+
+		++m_trace.num_unbinds;
+		trace(CommandType::UnbindOutputs, false);
+	}
+
+	void GPUBackend::update(const Buffer* buffer, const void* data)
+	{
+		if (buffer == nullptr)
+		{
+			camy_error("Can't update null buffer / resource");
+			return;
+		}
+
+		if (data == nullptr)
+		{
+			camy_error("Can't update buffer with null data");
+			return;
+		}
+
+		const auto size{ buffer->element_count * buffer->element_size };
+
+		++m_trace.num_buffer_updates;
+		m_trace.buffer_update_size += size;
+		trace(CommandType::UpdateBuffer, false, size);
+	}
+
+	void GPUBackend::upload(const UploadQueue::Chunk& chunk)
+	{
+		++m_trace.num_resource_uploads;
+		m_trace.resource_upload_size += static_cast<u64>(chunk.num_rows) * chunk.pitch;
+	}
+
+	void GPUBackend::clear_surface(const Surface* surface, const float* color, const float depth, const u32 stencil)
+	{
+		if (surface == nullptr)
+		{
+			camy_warning("Tried to clear a null surface");
+			return;
+		}
+
+		++m_trace.num_clears;
+		trace(CommandType::ClearSurface, false);
+	}
+
+	void GPUBackend::swap_buffers(const Surface* window_surface)
+	{
+		if (window_surface == nullptr)
+		{
+			camy_error("Tried to swap buffers with invalid window surface");
+			return;
+		}
+
+		++m_trace.num_presents;
+	}
+
+	InputSignature* GPUBackend::create_input_signature(const void* compiled_bytecode, Size bytecode_size, const void* inputs, Size num_inputs)
+	{
+		return m_resources.allocate<InputSignature>();
+	}
+
+	Buffer* GPUBackend::create_buffer(Buffer::Type type, u32 num_elements, u32 element_size, bool use_uav)
+	{
+		auto buffer_r{ m_resources.allocate<Buffer>() };
+		buffer_r->element_count = num_elements;
+		buffer_r->element_size = element_size;
+		buffer_r->type = type;
+		buffer_r->is_dynamic = !use_uav;
+
+		return buffer_r;
+	}
+
+	VertexBuffer* GPUBackend::create_vertex_buffer(u32 element_size, u32 num_elements, const void* data, bool is_dynamic)
+	{
+		auto vertex_buffer_r{ m_resources.allocate<VertexBuffer>() };
+		vertex_buffer_r->element_size = element_size;
+		vertex_buffer_r->element_count = num_elements;
+		vertex_buffer_r->is_dynamic = is_dynamic;
+
+		return vertex_buffer_r;
+	}
+
+	IndexBuffer* GPUBackend::create_index_buffer(IndexBuffer::Type index_type, u32 num_elements, const void* data, bool is_dynamic)
+	{
+		auto index_buffer_r{ m_resources.allocate<IndexBuffer>() };
+		index_buffer_r->index_type = index_type;
+		index_buffer_r->element_count = num_elements;
+
+		return index_buffer_r;
+	}
+
+	ConstantBuffer* GPUBackend::create_constant_buffer(u32 size)
+	{
+		auto cbuffer_r{ m_resources.allocate<ConstantBuffer>() };
+		cbuffer_r->size = size;
+
+		return cbuffer_r;
+	}
+
+	Surface* GPUBackend::create_texture2D(Surface::Format format, u32 width, u32 height, const SubSurface* subsurfaces, u32 num_subsurfaces, bool is_dynamic, u8 msaa_level)
+	{
+		Surface::Description description;
+		description.format = format;
+		description.format_srv = format;
+		description.width = width;
+		description.height = height;
+		description.msaa_level = msaa_level;
+		description.is_dynamic = is_dynamic;
+
+		return create_surface(description, true, false, false, false, subsurfaces, num_subsurfaces);
+	}
+
+	Surface* GPUBackend::create_render_target(Surface::Format format, u32 width, u32 height, u8 msaa_level)
+	{
+		Surface::Description description;
+		description.format = format;
+		description.format_srv = format;
+		description.format_rtv = format;
+		description.width = width;
+		description.height = height;
+		description.msaa_level = msaa_level;
+
+		return create_surface(description, true, true, false, false);
+	}
+
+	Surface* GPUBackend::create_depth_buffer(Surface::Format format, u32 width, u32 height, u8 msaa_level)
+	{
+		Surface::Description description;
+		description.format = format;
+		description.format_dsv = format;
+		description.width = width;
+		description.height = height;
+		description.msaa_level = msaa_level;
+
+		return create_surface(description, false, false, true, false);
+	}
+
+	Surface* GPUBackend::create_surface(const Surface::Description& description, bool use_srv, bool use_rtv, bool use_dsv, bool use_uav, const SubSurface* subsurfaces, u32 num_subsurfaces)
+	{
+		camy_assert(description.width > 0 && description.height > 0, { return nullptr; }, "Trying to create texture with width or height == 0");
+		camy_assert(description.msaa_level > 0, { return nullptr; }, "MSAA Level has to be > 0 ");
+
+		auto surface_r{ m_resources.allocate<Surface>() };
+		surface_r->description = description;
+
+		return surface_r;
+	}
+
+	// State objects are shared the same way as on the D3D11 backend, redundant binds are then the same
+	BlendState* GPUBackend::create_blend_state(BlendState::Mode blend_mode)
+	{
+		return m_blend_states.acquire({ blend_mode }, [this](const BlendState::Description& description)
+		{
+			auto blend_state_r{ m_resources.allocate<BlendState>() };
+			blend_state_r->mode = description.mode;
+
+			return blend_state_r;
+		});
+	}
+
+	RasterizerState* GPUBackend::create_rasterizer_state(RasterizerState::Cull cull, RasterizerState::Fill fill, u32 bias, float bias_max, float bias_slope)
+	{
+		return m_rasterizer_states.acquire({ cull, fill, bias, bias_max, bias_slope }, [this](const RasterizerState::Description& description)
+		{
+			auto rasterizer_state_r{ m_resources.allocate<RasterizerState>() };
+			rasterizer_state_r->cull = description.cull;
+			rasterizer_state_r->fill = description.fill;
+
+			return rasterizer_state_r;
+		});
+	}
+
+	Sampler* GPUBackend::create_sampler(Sampler::Filter filter, Sampler::Address address, Sampler::Comparison comparison)
+	{
+		return m_samplers.acquire({ filter, address, comparison }, [this](const Sampler::Description& description)
+		{
+			auto sampler_r{ m_resources.allocate<Sampler>() };
+			sampler_r->address = description.address;
+			sampler_r->filter = description.filter;
+			sampler_r->comparison = description.comparison;
+
+			return sampler_r;
+		});
+	}
+
+	hidden::Shader* GPUBackend::create_shader(Shader::Type type, const void* compiled_bytecode, Size bytecode_size)
+	{
+		if (compiled_bytecode == nullptr || bytecode_size == 0)
+		{
+			camy_error("Failed to create shader");
+			return nullptr;
+		}
+
+		return m_resources.allocate<hidden::Shader>();
+	}
+
+	DepthStencilState* GPUBackend::create_depth_stencil_state()
+	{
+		return m_depth_stencil_states.acquire(0, [this](u32) { return m_resources.allocate<DepthStencilState>(); });
+	}
+
+	Surface* GPUBackend::create_window_surface(WindowHandle window_handle, u8 msaa_level)
+	{
+		auto window_surface_r{ m_resources.allocate<Surface>() };
+		window_surface_r->description.width = null_window_width;
+		window_surface_r->description.height = null_window_height;
+		window_surface_r->description.format = Surface::Format::RGBA8Unorm;
+		window_surface_r->description.msaa_level = msaa_level;
+		window_surface_r->hidden.window_handle = window_handle;
+
+		return window_surface_r;
+	}
+}
+
+#endif
@@ -0,0 +1,187 @@
+// Header
+#include <camy/pipeline_cache.hpp>
+
+// camy
+#include <camy/error.hpp>
+
+// C++ STL
+#include <cstring>
+
+namespace camy
+{
+	PipelineCache::PipelineCache()
+	{
+		reset();
+	}
+
+	bool PipelineCache::set_input_layout(const void* input_layout)
+	{
+		const bool changed{ m_input_layout != input_layout };
+		m_input_layout = input_layout;
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_vertex_buffer(u32 slot, const void* buffer, u32 stride, u32 offset)
+	{
+		if (slot >= features::max_bindable_vertex_buffers)
+		{
+			camy_warning("Vertex buffer slot out of bounds: ", slot);
+			return false;
+		}
+
+		auto& bound{ m_vertex_buffers[slot] };
+		const bool changed{ bound.buffer != buffer || bound.stride != stride || bound.offset != offset };
+		bound = { buffer, stride, offset };
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_index_buffer(const void* buffer, u32 format)
+	{
+		const bool changed{ m_index_buffer != buffer || m_index_format != format };
+		m_index_buffer = buffer;
+		m_index_format = format;
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_primitive_topology(u32 primitive_topology)
+	{
+		const bool changed{ m_primitive_topology != primitive_topology };
+		m_primitive_topology = primitive_topology;
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_shader(Shader::Type type, const void* shader)
+	{
+		auto& bound{ m_shaders[static_cast<u32>(type)] };
+		const bool changed{ bound != shader };
+		bound = shader;
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_samplers(Shader::Type type, u32& first_slot, u32& num_slots, const void* const* samplers)
+	{
+		return _set_range(m_samplers[static_cast<u32>(type)], features::max_bindable_samplers, first_slot, num_slots, samplers);
+	}
+
+	bool PipelineCache::set_shader_resources(Shader::Type type, u32& first_slot, u32& num_slots, const void* const* views)
+	{
+		return _set_range(m_shader_resources[static_cast<u32>(type)], features::max_bindable_shader_resources, first_slot, num_slots, views);
+	}
+
+	bool PipelineCache::set_unordered_access_views(u32& first_slot, u32& num_slots, const void* const* views)
+	{
+		return _set_range(m_unordered_access_views, features::max_bindable_shader_resources, first_slot, num_slots, views);
+	}
+
+	bool PipelineCache::set_constant_buffer(Shader::Type type, u32 slot, const void* buffer, u32 first_constant, u32 num_constants)
+	{
+		if (slot >= features::max_bindable_constant_buffers)
+		{
+			camy_warning("Constant buffer slot out of bounds: ", slot);
+			return false;
+		}
+
+		auto& bound{ m_constant_buffers[static_cast<u32>(type)][slot] };
+		const bool changed{ bound.buffer != buffer || bound.first_constant != first_constant || bound.num_constants != num_constants };
+		bound = { buffer, first_constant, num_constants };
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_viewport(float left, float top, float width, float height)
+	{
+		const float viewport[4]{ left, top, width, height };
+		const bool changed{ std::memcmp(m_viewport, viewport, sizeof(m_viewport)) != 0 };
+		std::memcpy(m_viewport, viewport, sizeof(m_viewport));
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_rasterizer_state(const void* rasterizer_state)
+	{
+		const bool changed{ m_rasterizer_state != rasterizer_state };
+		m_rasterizer_state = rasterizer_state;
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_outputs(const void* const* render_targets, const void* depth_buffer)
+	{
+		const bool changed{ std::memcmp(m_render_targets, render_targets, sizeof(m_render_targets)) != 0 || m_depth_buffer != depth_buffer };
+		std::memcpy(m_render_targets, render_targets, sizeof(m_render_targets));
+		m_depth_buffer = depth_buffer;
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_blend_state(const void* blend_state)
+	{
+		const bool changed{ m_blend_state != blend_state };
+		m_blend_state = blend_state;
+		return _bind(changed);
+	}
+
+	bool PipelineCache::set_depth_stencil_state(const void* depth_stencil_state)
+	{
+		const bool changed{ m_depth_stencil_state != depth_stencil_state };
+		m_depth_stencil_state = depth_stencil_state;
+		return _bind(changed);
+	}
+
+	void PipelineCache::reset()
+	{
+		// Cleared context, the counters are kept
+		m_input_layout = nullptr;
+		std::memset(m_vertex_buffers, 0, sizeof(m_vertex_buffers));
+		m_index_buffer = nullptr;
+		m_index_format = 0;
+		m_primitive_topology = 0;
+
+		std::memset(m_shaders, 0, sizeof(m_shaders));
+		std::memset(m_samplers, 0, sizeof(m_samplers));
+		std::memset(m_shader_resources, 0, sizeof(m_shader_resources));
+		std::memset(m_unordered_access_views, 0, sizeof(m_unordered_access_views));
+		std::memset(m_constant_buffers, 0, sizeof(m_constant_buffers));
+
+		std::memset(m_viewport, 0, sizeof(m_viewport));
+		m_rasterizer_state = nullptr;
+
+		std::memset(m_render_targets, 0, sizeof(m_render_targets));
+		m_depth_buffer = nullptr;
+		m_blend_state = nullptr;
+		m_depth_stencil_state = nullptr;
+	}
+
+	bool PipelineCache::_bind(bool changed)
+	{
+		if (changed)
+			++m_stats.num_issued_binds;
+		else
+			++m_stats.num_skipped_binds;
+		return changed;
+	}
+
+	bool PipelineCache::_set_range(const void** bound, u32 max_slots, u32& first_slot, u32& num_slots, const void* const* objects)
+	{
+		if (first_slot + num_slots > max_slots)
+		{
+			camy_warning("Bind range out of bounds: ", first_slot, " | ", num_slots);
+			return false;
+		}
+
+		// First and one past the last slot that changed
+		auto first{ 0u };
+		while (first < num_slots && bound[first_slot + first] == objects[first])
+			++first;
+
+		if (first == num_slots)
+			return _bind(false);
+
+		auto end{ num_slots };
+		while (bound[first_slot + end - 1] == objects[end - 1])
+			--end;
+
+		for (auto i{ first }; i < end; ++i)
+			bound[first_slot + i] = objects[i];
+
+		first_slot += first;
+		num_slots = end - first;
+		return _bind(true);
+	}
+}
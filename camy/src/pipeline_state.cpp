@@ -0,0 +1,143 @@
+// Header
+#include <camy/pipeline_state.hpp>
+
+// camy
+#include <camy/error.hpp>
+#include <camy/hash.hpp>
+
+// C++ STL
+#include <cstring>
+
+namespace camy
+{
+	namespace
+	{
+		PipelineState::Id field_mask(u32 shift, u32 bits)
+		{
+			return ((static_cast<PipelineState::Id>(1) << bits) - 1) << shift;
+		}
+	}
+
+	u32 diff_common_states(const CommonStates& a, const CommonStates& b)
+	{
+		u32 parts{ CommonStatesParts_None };
+
+		if (a.depth_buffer != b.depth_buffer || std::memcmp(a.render_targets, b.render_targets, sizeof(a.render_targets)) != 0)
+			parts |= CommonStatesParts_Outputs;
+		if (std::memcmp(&a.viewport, &b.viewport, sizeof(Viewport)) != 0)
+			parts |= CommonStatesParts_Viewport;
+		if (a.blend_state != b.blend_state)
+			parts |= CommonStatesParts_BlendState;
+		if (a.rasterizer_state != b.rasterizer_state)
+			parts |= CommonStatesParts_RasterizerState;
+		if (a.depth_stencil_state != b.depth_stencil_state)
+			parts |= CommonStatesParts_DepthStencilState;
+
+		return parts;
+	}
+
+	u32 PipelineState::diff(Id a, Id b)
+	{
+		const auto changed{ a ^ b };
+		if (changed == 0)
+			return PipelineStates_None;
+
+		u32 states{ PipelineStates_None };
+		if (changed & field_mask(common_states_shift, common_states_bits))
+			states |= PipelineStates_CommonStates;
+		if (changed & field_mask(vertex_shader_shift, shader_bits))
+			states |= PipelineStates_VertexShader;
+		if (changed & field_mask(geometry_shader_shift, shader_bits))
+			states |= PipelineStates_GeometryShader;
+		if (changed & field_mask(pixel_shader_shift, shader_bits))
+			states |= PipelineStates_PixelShader;
+		if (changed & field_mask(topology_shift, topology_bits))
+			states |= PipelineStates_PrimitiveTopology;
+
+		return states;
+	}
+
+	const PipelineState* PipelineStateCache::get(const PipelineState::Description& description)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const auto common_states_id{ _common_states_id(description.common_states) };
+		const auto vertex_shader_id{ _shader_id(description.vertex_shader) };
+		const auto geometry_shader_id{ _shader_id(description.geometry_shader) };
+		const auto pixel_shader_id{ _shader_id(description.pixel_shader) };
+		const auto topology_id{ static_cast<u32>(description.primitive_topology) };
+
+		if (common_states_id >= (1u << PipelineState::common_states_bits) ||
+			vertex_shader_id >= (1u << PipelineState::shader_bits) ||
+			geometry_shader_id >= (1u << PipelineState::shader_bits) ||
+			pixel_shader_id >= (1u << PipelineState::shader_bits) ||
+			topology_id >= (1u << PipelineState::topology_bits))
+		{
+			camy_error("Failed to create pipeline state, too many unique states");
+			return nullptr;
+		}
+
+		const PipelineState::Id id{
+			static_cast<PipelineState::Id>(common_states_id) << PipelineState::common_states_shift |
+			static_cast<PipelineState::Id>(vertex_shader_id) << PipelineState::vertex_shader_shift |
+			static_cast<PipelineState::Id>(geometry_shader_id) << PipelineState::geometry_shader_shift |
+			static_cast<PipelineState::Id>(pixel_shader_id) << PipelineState::pixel_shader_shift |
+			static_cast<PipelineState::Id>(topology_id) << PipelineState::topology_shift };
+
+		// Same id, same states
+		auto found{ m_pipeline_states.find(id) };
+		if (found != m_pipeline_states.end())
+			return &found->second;
+
+		return &m_pipeline_states.emplace(id, PipelineState(id, description)).first->second;
+	}
+
+	void PipelineStateCache::clear()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_common_states.clear();
+		m_common_states_ids.clear();
+		m_shader_ids.clear();
+		m_pipeline_states.clear();
+	}
+
+	u32 PipelineStateCache::get_num_pipeline_states()const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return static_cast<u32>(m_pipeline_states.size());
+	}
+
+	u32 PipelineStateCache::_common_states_id(const CommonStates& common_states)
+	{
+		const auto hash{ fnv1a(&common_states, sizeof(CommonStates)) };
+
+		auto range{ m_common_states_ids.equal_range(hash) };
+		for (auto it{ range.first }; it != range.second; ++it)
+		{
+			if (std::memcmp(&m_common_states[it->second - 1], &common_states, sizeof(CommonStates)) == 0)
+				return it->second;
+		}
+
+		m_common_states.push_back(common_states);
+		const auto id{ static_cast<u32>(m_common_states.size()) };
+		m_common_states_ids.emplace(hash, id);
+
+		return id;
+	}
+
+	u32 PipelineStateCache::_shader_id(const Shader* shader)
+	{
+		if (shader == nullptr)
+			return 0;
+
+		auto found{ m_shader_ids.find(shader) };
+		if (found != m_shader_ids.end())
+			return found->second;
+
+		const auto id{ static_cast<u32>(m_shader_ids.size()) + 1 };
+		m_shader_ids.emplace(shader, id);
+
+		return id;
+	}
+}
@@ -1,81 +1,156 @@
-// Header
-#include <camy/resources.hpp>
-
-#define NOMINMAX
-#include <d3d11.h>
-#include <dxgi.h>
-#undef NOMINMAX
-
-namespace camy
-{
-	namespace hidden
-	{
-		void Surface::dispose()
-		{
-			safe_release_com(texture_2d);
-			safe_release_com(srv);
-			safe_release_com(rtv);
-			safe_release_com(dsv);
-			safe_release_com(swap_chain);
-		}
-
-		void Buffer::dispose()
-		{
-			safe_release_com(buffer);
-			safe_release_com(srv);
-		}
-
-		void VertexBuffer::dispose()
-		{
-			safe_release_com(buffer);
-		}
-
-		void IndexBuffer::dispose()
-		{
-			safe_release_com(buffer);
-		}
-
-		void ConstantBuffer::dispose()
-		{
-			safe_release_com(buffer);
-		}
-
-		void BlendState::dispose()
-		{
-			safe_release_com(state);
-		}
-
-		void RasterizerState::dispose()
-		{
-			safe_release_com(state);
-		}
-
-		void InputSignature::dispose()
-		{
-			safe_release_com(input_layout);
-		}
-
-		void Sampler::dispose()
-		{
-			safe_release_com(sampler);
-		}
-
-		void Shader::dispose()
-		{
-			safe_release_com(shader);
-		}
-	}
-
-	Surface::Format Surface::translate(u32 format)
-	{
-		DXGI_FORMAT dxgi_format{ static_cast<DXGI_FORMAT>(format) };
-		switch (dxgi_format)
-		{
-		case DXGI_FORMAT_BC3_UNORM:
-			return Format::BC3Unorm;
-
-		default:
-			return Format::Unknown;
-		}
-	}
-}
\ No newline at end of file
+// Header
+#include <camy/resources.hpp>
+
+#if defined(camy_backend_null)
+// No API objects are ever created by the null backend, handles are always null
+#define camy_release_handle(handle) handle = nullptr
+#else
+#define NOMINMAX
+#include <d3d11.h>
+#include <dxgi.h>
+#undef NOMINMAX
+#define camy_release_handle(handle) safe_release_com(handle)
+#endif
+
+namespace camy
+{
+	namespace hidden
+	{
+		void Surface::dispose()
+		{
+			camy_release_handle(texture_2d);
+			camy_release_handle(srv);
+			camy_release_handle(rtv);
+			camy_release_handle(dsv);
+			camy_release_handle(swap_chain);
+		}
+
+		void Buffer::dispose()
+		{
+			camy_release_handle(buffer);
+			camy_release_handle(srv);
+		}
+
+		void VertexBuffer::dispose()
+		{
+			camy_release_handle(buffer);
+		}
+
+		void IndexBuffer::dispose()
+		{
+			camy_release_handle(buffer);
+		}
+
+		void ConstantBuffer::dispose()
+		{
+			camy_release_handle(buffer);
+		}
+
+		void BlendState::dispose()
+		{
+			camy_release_handle(state);
+		}
+
+		void RasterizerState::dispose()
+		{
+			camy_release_handle(state);
+		}
+
+		void InputSignature::dispose()
+		{
+			camy_release_handle(input_layout);
+		}
+
+		void Sampler::dispose()
+		{
+			camy_release_handle(sampler);
+		}
+
+		void Shader::dispose()
+		{
+			camy_release_handle(shader);
+		}
+	}
+
+	Surface::Format Surface::translate(u32 format)
+	{
+#if defined(camy_backend_null)
+		// Same values as DXGI_FORMAT, textures are still loaded from DDS files
+		const u32 dxgi_format_bc3_unorm{ 77 };
+		if (format == dxgi_format_bc3_unorm)
+			return Format::BC3Unorm;
+		return Format::Unknown;
+#else
+		DXGI_FORMAT dxgi_format{ static_cast<DXGI_FORMAT>(format) };
+		switch (dxgi_format)
+		{
+		case DXGI_FORMAT_BC3_UNORM:
+			return Format::BC3Unorm;
+
+		default:
+			return Format::Unknown;
+		}
+#endif
+	}
+	namespace
+	{
+		u32 bits_per_texel(Surface::Format format)
+		{
+			switch (format)
+			{
+			case Surface::Format::BC1Unorm:
+				return 4;
+			case Surface::Format::BC3Unorm:
+				return 8;
+			case Surface::Format::R16Typeless:
+			case Surface::Format::R16Float:
+			case Surface::Format::R16Unorm:
+			case Surface::Format::D16Unorm:
+				return 16;
+			case Surface::Format::RGB16Float:
+				return 48;
+			case Surface::Format::RGBA16Float:
+				return 64;
+			case Surface::Format::RGBA32Float:
+				return 128;
+			case Surface::Format::Unknown:
+				return 0;
+			default:
+				return 32;
+			}
+		}
+	}
+
+	u64 resource_size(const Surface& surface)
+	{
+		const auto& description{ surface.description };
+
+		// Typeless surfaces might have only the view formats
+		auto format{ description.format };
+		if (format == Surface::Format::Unknown)
+			format = description.format_srv != Surface::Format::Unknown ? description.format_srv :
+				description.format_rtv != Surface::Format::Unknown ? description.format_rtv : description.format_dsv;
+
+		return static_cast<u64>(description.width) * description.height * description.msaa_level * bits_per_texel(format) / 8;
+	}
+
+	u64 resource_size(const Buffer& buffer)
+	{
+		return static_cast<u64>(buffer.element_size) * buffer.element_count;
+	}
+
+	u64 resource_size(const VertexBuffer& vertex_buffer)
+	{
+		return static_cast<u64>(vertex_buffer.element_size) * vertex_buffer.element_count;
+	}
+
+	u64 resource_size(const IndexBuffer& index_buffer)
+	{
+		return static_cast<u64>(index_buffer.index_type == IndexBuffer::Type::U32 ? 4 : 2) * index_buffer.element_count;
+	}
+
+	u64 resource_size(const ConstantBuffer& constant_buffer)
+	{
+		return constant_buffer.size;
+	}
+}
@@ -1,226 +1,486 @@
-// Header
-#include <camy/shader.hpp>
-
-// camy
-#include <camy/init.hpp>
-#include <camy/gpu_backend.hpp>
-
-// C++ STL
-#include <algorithm>
-
-namespace camy
-{
-	Shader::Shader() :
-		// type is left uninitialized on purpose
-		
-		m_shader{ nullptr },
-		m_input_signature{ nullptr }
-	{
-	
-	}
-
-	Shader::~Shader()
-	{
-		unload();
-	}
-
-	bool Shader::load(Type type, const void* compiled_bytecode, const Size bytecode_size)
-	{
-		m_type = type;
-
-		if (compiled_bytecode == nullptr)
-		{
-			camy_error("Tried to load a shader with null bytecode, check your loading code!");
-			return false;
-		}
-
-		unload();
-		reflect(compiled_bytecode, bytecode_size);
-
-		m_shader = hidden::gpu.create_shader(m_type, compiled_bytecode, bytecode_size);
-		if (m_shader == nullptr)
-		{
-			unload();
-			return false;
-		}
-
-		return true;
-	}
-
-	void Shader::unload()
-	{
-		// Shaders
-		hidden::gpu.safe_dispose(m_shader);
-		hidden::gpu.safe_dispose(m_input_signature);
-	}
-
-	ShaderVariable Shader::get(const char* name)const
-	{
-		if (m_variables.find(name) == m_variables.end())
-		{
-			camy_warning("Failed to retrieve ", name, " from shader, subsequent sets/binds might fail");
-			return ShaderVariable(0);
-		}
-
-		// Ok why not accessing with operator [] ? the reason is that it's not const:
-		// http://www.cplusplus.com/reference/unordered_map/unordered_map/operator[]/
-		// Thus the compiler will refuse to compile this copnst method
-		return m_variables.find(name)->second;
-	}
-
-	bool Shader::reflect(const void* compiled_bytecode, const Size bytecode_size)
-	{
-		// Clearing
-		m_variables.clear();
-
-		////////////////////////////////////
-		
-		ID3D11ShaderReflection* shader_reflection{ nullptr };
-		D3DReflect(compiled_bytecode, bytecode_size, camy_uuid_ptr(shader_reflection));
-
-		D3D11_SHADER_DESC shader_desc;
-		shader_reflection->GetDesc(&shader_desc);
-
-		auto bound_cbuffers{ shader_desc.ConstantBuffers };
-
-		// Here we decode all the cbuffers and tbuffers, when the user wants to access them, can either access the whole buffer
-		// or the single variables, this doesn't hold true
-		for (auto i{ 0u }; i < bound_cbuffers; ++i)
-		{
-			auto cbuffer{ shader_reflection->GetConstantBufferByIndex(i) };
-			D3D11_SHADER_BUFFER_DESC cbuffer_desc;
-			cbuffer->GetDesc(&cbuffer_desc);
-
-			switch (cbuffer_desc.Type)
-			{
-			case D3D_CT_TBUFFER:
-				camy_warning("TextureBuffers are not supported yet");
-				continue;
-			case D3D_CT_CBUFFER:
-				break;
-			default:
-				// This warning pollutes the output when reflecting compute shaders, because any RWStructuredBuffer ( maybe others aswell, haven't tested ) 
-				// will be passed as Constant buffer, thus i'm not outputing any warning
-				continue;
-			}
-
-			// To find the binding slot i have to query the resource type, index does not refer to binding point
-			D3D11_SHADER_INPUT_BIND_DESC bind_desc;
-			shader_reflection->GetResourceBindingDescByName(cbuffer_desc.Name, &bind_desc);
-
-			ShaderVariable cbuffer_variable;
-			// Tbuffers are bound as shaderresoures
-			cbuffer_variable.type = static_cast<u32>(BindType::ConstantBuffer);
-			cbuffer_variable.slot = bind_desc.BindPoint;
-			cbuffer_variable.size = cbuffer_desc.Size;
-			cbuffer_variable.shader_type = static_cast<u32>(m_type);
-			cbuffer_variable.is_uav = 0;
-
-			m_variables[cbuffer_desc.Name] = cbuffer_variable;
-		}	
-
-		for (auto i{ 0u }; i < shader_desc.BoundResources; ++i)
-		{
-			D3D11_SHADER_INPUT_BIND_DESC bind_desc;
-			shader_reflection->GetResourceBindingDesc(i, &bind_desc);
-
-			auto is_uav{ 0 };
-			BindType type;
-			switch (bind_desc.Type)
-			{
-			case D3D_SIT_CBUFFER: // We evaluated cbuffers separately
-			case D3D_SIT_TBUFFER: // Same for tbuffers
-				continue;
-			case D3D_SIT_SAMPLER:
-				type = BindType::Sampler; break;
-			case D3D_SIT_UAV_RWTYPED:
-			case D3D_SIT_UAV_RWSTRUCTURED:
-			case D3D_SIT_UAV_RWBYTEADDRESS:
-			case D3D_SIT_UAV_APPEND_STRUCTURED:
-			case D3D_SIT_UAV_CONSUME_STRUCTURED:
-			case D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER:
-				is_uav = 1;
-			case D3D_SIT_STRUCTURED:
-			case D3D_SIT_BYTEADDRESS:
-				type = BindType::Buffer; break;
-			case D3D_SIT_TEXTURE:
-				type = BindType::Surface; break;
-			default:
-				camy_warning("Resource: ", bind_desc.Name, " has a not-recognized / not supported type, skipping"); continue;
-			}
-
-			ShaderVariable shader_variable;
-			shader_variable.type = static_cast<u32>(type);
-			shader_variable.slot = bind_desc.BindPoint;
-			shader_variable.size = bind_desc.BindCount;
-			shader_variable.shader_type = static_cast<u32>(m_type);
-			shader_variable.is_uav = is_uav;
-
-			m_variables[bind_desc.Name] = shader_variable;
-		}
-
-		// It's quite easy to notice since it's camelCase
-		std::vector<D3D11_INPUT_ELEMENT_DESC> input_layout_desc;
-		for (unsigned int i = 0; i< shader_desc.InputParameters; i++)
-		{
-			D3D11_SIGNATURE_PARAMETER_DESC param_desc;
-			shader_reflection->GetInputParameterDesc(i, &param_desc);
-
-			D3D11_INPUT_ELEMENT_DESC element_desc;
-			element_desc.SemanticName = param_desc.SemanticName;
-			element_desc.SemanticIndex = param_desc.SemanticIndex;
-			element_desc.InputSlot = 0;
-			element_desc.AlignedByteOffset = D3D11_APPEND_ALIGNED_ELEMENT;
-			element_desc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
-			element_desc.InstanceDataStepRate = 0;
-
-			if (param_desc.Mask == 1)
-			{
-				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32_UINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32_SINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32_FLOAT;
-			}
-			else if (param_desc.Mask <= 3)
-			{
-				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32G32_UINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32G32_SINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32G32_FLOAT;
-			}
-			else if (param_desc.Mask <= 7)
-			{
-				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32G32B32_UINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32G32B32_SINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32G32B32_FLOAT;
-			}
-			else if (param_desc.Mask <= 15)
-			{
-				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32G32B32A32_UINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32G32B32A32_SINT;
-				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
-			}
-
-			input_layout_desc.push_back(element_desc);
-		}
-
-		if (m_type == Shader::Type::Vertex)
-		{
-			camy_assert(!input_layout_desc.empty(), , "Vertex shader with no input layout?");
-
-			// Todo : this is to allow for interleaved data, position is set to 0, all the rest is incremeneted by 1
-			input_layout_desc[0].InputSlot = 0;
-			for (auto i{ 1u }; i < input_layout_desc.size(); ++i)
-				input_layout_desc[i].InputSlot = 1;
-
-			m_input_signature = hidden::gpu.create_input_signature(compiled_bytecode, bytecode_size, &input_layout_desc[0], input_layout_desc.size());
-			if (m_input_signature == nullptr)
-			{
-				camy_error("Failed to create input signature for shader");
-				safe_release_com(shader_reflection);
-				return false;
-			}
-		}
-
-		safe_release_com(shader_reflection);
-		return true;
-	}
-}
\ No newline at end of file
+// Header
+#include <camy/shader.hpp>
+
+// camy
+#include <camy/init.hpp>
+#include <camy/gpu_backend.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cstring>
+
+namespace camy
+{
+	Shader::Shader() :
+		// type is left uninitialized on purpose
+		
+		m_shader{ nullptr },
+		m_input_signature{ nullptr }
+	{
+	
+	}
+
+	Shader::~Shader()
+	{
+		unload();
+	}
+
+	bool Shader::load(Type type, const void* compiled_bytecode, const Size bytecode_size)
+	{
+		m_type = type;
+
+		if (compiled_bytecode == nullptr)
+		{
+			camy_error("Tried to load a shader with null bytecode, check your loading code!");
+			return false;
+		}
+
+		unload();
+		reflect(compiled_bytecode, bytecode_size);
+		build_variable_table();
+
+		m_shader = hidden::gpu.create_shader(m_type, compiled_bytecode, bytecode_size);
+		if (m_shader == nullptr)
+		{
+			unload();
+			return false;
+		}
+
+		return true;
+	}
+
+	void Shader::unload()
+	{
+		// Shaders
+		hidden::gpu.safe_dispose(m_shader);
+		hidden::gpu.safe_dispose(m_input_signature);
+
+		m_variables.clear();
+	}
+
+	ShaderVariable Shader::get(const ShaderVariableName& name)const
+	{
+		const auto mask{ static_cast<u32>(m_variables.size()) - 1 };
+		for (auto probe{ 0u }; probe < m_variables.size(); ++probe)
+		{
+			const auto& entry{ m_variables[(name.hash + probe) & mask] };
+			if (entry.variable.valid == 0)
+				break;
+
+			if (entry.hash == name.hash && entry.name == name.name)
+				return entry.variable;
+		}
+
+		camy_warning("Failed to retrieve ", name.name, " from shader, subsequent sets/binds might fail");
+		return ShaderVariable(0);
+	}
+
+	void Shader::add_variable(const char* name, ShaderVariable variable)
+	{
+		variable.valid = 1;
+
+		const auto hash{ fnv1a(name) };
+		for (auto& entry : m_variables)
+		{
+			if (entry.hash != hash)
+				continue;
+
+			// Same name reflected twice ( e.g. a cbuffer and its binding ), the last one is kept as before hashing
+			if (entry.name == name)
+			{
+				entry.variable = variable;
+				return;
+			}
+
+			// The table is sized for distinct hashes, keeping both would make lookups probe. Renaming is the fix
+			camy_error("Shader variables: ", entry.name, " and ", name, " have the same hash, ", name, " can't be retrieved. Rename one of them");
+			return;
+		}
+
+		m_variables.push_back({ hash, variable, name });
+	}
+
+	void Shader::build_variable_table()
+	{
+		// Smallest power of two where hashes don't collide, most shaders have less than 16 variables
+		static const u32 max_table_size{ 1024 };
+
+		const auto variables{ std::move(m_variables) };
+		auto table_size{ 1u };
+		while (table_size < variables.size() * 2)
+			table_size <<= 1;
+
+		for (; table_size < max_table_size; table_size <<= 1)
+		{
+			u32 used[max_table_size / 32]{ 0 };
+			bool collision{ false };
+			for (const auto& entry : variables)
+			{
+				const auto index{ entry.hash & (table_size - 1) };
+				if (used[index / 32] & (1u << (index % 32)))
+				{
+					collision = true;
+					break;
+				}
+				used[index / 32] |= 1u << (index % 32);
+			}
+
+			if (!collision)
+				break;
+		}
+
+		// Linear probing if no size is collision free
+		m_variables.assign(table_size, { 0, ShaderVariable(0), std::string() });
+		for (const auto& entry : variables)
+		{
+			auto index{ entry.hash & (table_size - 1) };
+			while (m_variables[index].variable.valid != 0)
+				index = (index + 1) & (table_size - 1);
+			m_variables[index] = entry;
+		}
+	}
+
+#if defined(camy_backend_null)
+	namespace
+	{
+		// Layout of the DXBC container and of its RDEF ( resource definitions ) chunk, the same data D3DReflect reads
+		const u32 dxbc_chunk_count_offset{ 28 };
+		const u32 dxbc_chunk_offsets_offset{ 32 };
+		const u32 rdef_header_size{ 16 };
+		const u32 rdef_cbuffer_size{ 24 };
+		const u32 rdef_binding_size{ 32 };
+
+		// D3D_SHADER_INPUT_TYPE and D3D_CBUFFER_TYPE values
+		enum RDEFType : u32
+		{
+			RDEFType_CBuffer = 0,
+			RDEFType_TBuffer = 1,
+			RDEFType_Texture = 2,
+			RDEFType_Sampler = 3,
+			RDEFType_UAVRWTyped = 4,
+			RDEFType_Structured = 5,
+			RDEFType_UAVRWStructured = 6,
+			RDEFType_ByteAddress = 7,
+			RDEFType_UAVRWByteAddress = 8,
+			RDEFType_UAVAppendStructured = 9,
+			RDEFType_UAVConsumeStructured = 10,
+			RDEFType_UAVRWStructuredWithCounter = 11
+		};
+
+		u32 read_u32(const Byte* data)
+		{
+			u32 value;
+			std::memcpy(&value, data, sizeof(u32));
+			return value;
+		}
+
+		// Name at offset in the chunk, nullptr if not terminated inside it
+		const char* read_name(const Byte* chunk, u32 chunk_size, u32 offset)
+		{
+			if (offset >= chunk_size || std::memchr(chunk + offset, '\0', chunk_size - offset) == nullptr)
+				return nullptr;
+			return reinterpret_cast<const char*>(chunk + offset);
+		}
+	}
+
+	bool Shader::reflect(const void* compiled_bytecode, const Size bytecode_size)
+	{
+		// Clearing
+		m_variables.clear();
+
+		////////////////////////////////////
+
+		// There is no D3DReflect, the resource definitions are read directly from the bytecode
+		auto bytecode{ static_cast<const Byte*>(compiled_bytecode) };
+		if (bytecode_size < dxbc_chunk_offsets_offset || std::memcmp(bytecode, "DXBC", 4) != 0)
+		{
+			camy_error("Failed to reflect shader: not a DXBC container");
+			return false;
+		}
+
+		const Byte* rdef{ nullptr };
+		u32 rdef_size{ 0 };
+
+		const auto num_chunks{ read_u32(bytecode + dxbc_chunk_count_offset) };
+		for (auto i{ 0u }; i < num_chunks && rdef == nullptr; ++i)
+		{
+			const Size offset_position{ dxbc_chunk_offsets_offset + i * sizeof(u32) };
+			if (offset_position + sizeof(u32) > bytecode_size)
+				break;
+
+			const Size chunk_offset{ read_u32(bytecode + offset_position) };
+			if (chunk_offset + 8 > bytecode_size)
+				continue;
+
+			const auto chunk_size{ read_u32(bytecode + chunk_offset + 4) };
+			if (std::memcmp(bytecode + chunk_offset, "RDEF", 4) == 0 && chunk_offset + 8 + chunk_size <= bytecode_size)
+			{
+				rdef = bytecode + chunk_offset + 8;
+				rdef_size = chunk_size;
+			}
+		}
+
+		if (rdef == nullptr || rdef_size < rdef_header_size)
+		{
+			camy_error("Failed to reflect shader: missing resource definitions");
+			return false;
+		}
+
+		const auto num_cbuffers{ read_u32(rdef) };
+		const auto cbuffers_offset{ read_u32(rdef + 4) };
+		const auto num_bindings{ read_u32(rdef + 8) };
+		const auto bindings_offset{ read_u32(rdef + 12) };
+
+		if (static_cast<u64>(cbuffers_offset) + static_cast<u64>(num_cbuffers) * rdef_cbuffer_size > rdef_size ||
+			static_cast<u64>(bindings_offset) + static_cast<u64>(num_bindings) * rdef_binding_size > rdef_size)
+		{
+			camy_error("Failed to reflect shader: corrupted resource definitions");
+			return false;
+		}
+
+		for (auto i{ 0u }; i < num_bindings; ++i)
+		{
+			auto binding{ rdef + bindings_offset + i * rdef_binding_size };
+			auto name{ read_name(rdef, rdef_size, read_u32(binding)) };
+			if (name == nullptr)
+				continue;
+
+			auto is_uav{ 0 };
+			BindType type;
+			switch (read_u32(binding + 4))
+			{
+			case RDEFType_CBuffer:
+			{
+				// Size comes from the cbuffer with the same name
+				for (auto j{ 0u }; j < num_cbuffers; ++j)
+				{
+					auto cbuffer{ rdef + cbuffers_offset + j * rdef_cbuffer_size };
+					auto cbuffer_name{ read_name(rdef, rdef_size, read_u32(cbuffer)) };
+					if (cbuffer_name == nullptr || std::strcmp(cbuffer_name, name) != 0 || read_u32(cbuffer + 20) != RDEFType_CBuffer)
+						continue;
+
+					ShaderVariable cbuffer_variable;
+					cbuffer_variable.type = static_cast<u32>(BindType::ConstantBuffer);
+					cbuffer_variable.slot = read_u32(binding + 20);
+					cbuffer_variable.size = read_u32(cbuffer + 12);
+					cbuffer_variable.shader_type = static_cast<u32>(m_type);
+					cbuffer_variable.is_uav = 0;
+
+					add_variable(name, cbuffer_variable);
+					break;
+				}
+				continue;
+			}
+			case RDEFType_TBuffer:
+				camy_warning("TextureBuffers are not supported yet");
+				continue;
+			case RDEFType_Sampler:
+				type = BindType::Sampler; break;
+			case RDEFType_UAVRWTyped:
+			case RDEFType_UAVRWStructured:
+			case RDEFType_UAVRWByteAddress:
+			case RDEFType_UAVAppendStructured:
+			case RDEFType_UAVConsumeStructured:
+			case RDEFType_UAVRWStructuredWithCounter:
+				is_uav = 1;
+			case RDEFType_Structured:
+			case RDEFType_ByteAddress:
+				type = BindType::Buffer; break;
+			case RDEFType_Texture:
+				type = BindType::Surface; break;
+			default:
+				camy_warning("Resource: ", name, " has a not-recognized / not supported type, skipping"); continue;
+			}
+
+			ShaderVariable shader_variable;
+			shader_variable.type = static_cast<u32>(type);
+			shader_variable.slot = read_u32(binding + 20);
+			shader_variable.size = read_u32(binding + 24);
+			shader_variable.shader_type = static_cast<u32>(m_type);
+			shader_variable.is_uav = is_uav;
+
+			add_variable(name, shader_variable);
+		}
+
+		// Input layouts are never created, the signature is only there for the vertex shader to be complete
+		if (m_type == Shader::Type::Vertex)
+		{
+			m_input_signature = hidden::gpu.create_input_signature(compiled_bytecode, bytecode_size, nullptr, 0);
+			if (m_input_signature == nullptr)
+			{
+				camy_error("Failed to create input signature for shader");
+				return false;
+			}
+		}
+
+		return true;
+	}
+#else
+	bool Shader::reflect(const void* compiled_bytecode, const Size bytecode_size)
+	{
+		// Clearing
+		m_variables.clear();
+
+		////////////////////////////////////
+		
+		ID3D11ShaderReflection* shader_reflection{ nullptr };
+		D3DReflect(compiled_bytecode, bytecode_size, camy_uuid_ptr(shader_reflection));
+
+		D3D11_SHADER_DESC shader_desc;
+		shader_reflection->GetDesc(&shader_desc);
+
+		auto bound_cbuffers{ shader_desc.ConstantBuffers };
+
+		// Here we decode all the cbuffers and tbuffers, when the user wants to access them, can either access the whole buffer
+		// or the single variables, this doesn't hold true
+		for (auto i{ 0u }; i < bound_cbuffers; ++i)
+		{
+			auto cbuffer{ shader_reflection->GetConstantBufferByIndex(i) };
+			D3D11_SHADER_BUFFER_DESC cbuffer_desc;
+			cbuffer->GetDesc(&cbuffer_desc);
+
+			switch (cbuffer_desc.Type)
+			{
+			case D3D_CT_TBUFFER:
+				camy_warning("TextureBuffers are not supported yet");
+				continue;
+			case D3D_CT_CBUFFER:
+				break;
+			default:
+				// This warning pollutes the output when reflecting compute shaders, because any RWStructuredBuffer ( maybe others aswell, haven't tested ) 
+				// will be passed as Constant buffer, thus i'm not outputing any warning
+				continue;
+			}
+
+			// To find the binding slot i have to query the resource type, index does not refer to binding point
+			D3D11_SHADER_INPUT_BIND_DESC bind_desc;
+			shader_reflection->GetResourceBindingDescByName(cbuffer_desc.Name, &bind_desc);
+
+			ShaderVariable cbuffer_variable;
+			// Tbuffers are bound as shaderresoures
+			cbuffer_variable.type = static_cast<u32>(BindType::ConstantBuffer);
+			cbuffer_variable.slot = bind_desc.BindPoint;
+			cbuffer_variable.size = cbuffer_desc.Size;
+			cbuffer_variable.shader_type = static_cast<u32>(m_type);
+			cbuffer_variable.is_uav = 0;
+
+			add_variable(cbuffer_desc.Name, cbuffer_variable);
+		}	
+
+		for (auto i{ 0u }; i < shader_desc.BoundResources; ++i)
+		{
+			D3D11_SHADER_INPUT_BIND_DESC bind_desc;
+			shader_reflection->GetResourceBindingDesc(i, &bind_desc);
+
+			auto is_uav{ 0 };
+			BindType type;
+			switch (bind_desc.Type)
+			{
+			case D3D_SIT_CBUFFER: // We evaluated cbuffers separately
+			case D3D_SIT_TBUFFER: // Same for tbuffers
+				continue;
+			case D3D_SIT_SAMPLER:
+				type = BindType::Sampler; break;
+			case D3D_SIT_UAV_RWTYPED:
+			case D3D_SIT_UAV_RWSTRUCTURED:
+			case D3D_SIT_UAV_RWBYTEADDRESS:
+			case D3D_SIT_UAV_APPEND_STRUCTURED:
+			case D3D_SIT_UAV_CONSUME_STRUCTURED:
+			case D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER:
+				is_uav = 1;
+			case D3D_SIT_STRUCTURED:
+			case D3D_SIT_BYTEADDRESS:
+				type = BindType::Buffer; break;
+			case D3D_SIT_TEXTURE:
+				type = BindType::Surface; break;
+			default:
+				camy_warning("Resource: ", bind_desc.Name, " has a not-recognized / not supported type, skipping"); continue;
+			}
+
+			ShaderVariable shader_variable;
+			shader_variable.type = static_cast<u32>(type);
+			shader_variable.slot = bind_desc.BindPoint;
+			shader_variable.size = bind_desc.BindCount;
+			shader_variable.shader_type = static_cast<u32>(m_type);
+			shader_variable.is_uav = is_uav;
+
+			add_variable(bind_desc.Name, shader_variable);
+		}
+
+		// It's quite easy to notice since it's camelCase
+		std::vector<D3D11_INPUT_ELEMENT_DESC> input_layout_desc;
+		for (unsigned int i = 0; i< shader_desc.InputParameters; i++)
+		{
+			D3D11_SIGNATURE_PARAMETER_DESC param_desc;
+			shader_reflection->GetInputParameterDesc(i, &param_desc);
+
+			D3D11_INPUT_ELEMENT_DESC element_desc;
+			element_desc.SemanticName = param_desc.SemanticName;
+			element_desc.SemanticIndex = param_desc.SemanticIndex;
+			element_desc.InputSlot = 0;
+			element_desc.AlignedByteOffset = D3D11_APPEND_ALIGNED_ELEMENT;
+			element_desc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+			element_desc.InstanceDataStepRate = 0;
+
+			if (param_desc.Mask == 1)
+			{
+				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32_UINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32_SINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32_FLOAT;
+			}
+			else if (param_desc.Mask <= 3)
+			{
+				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32G32_UINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32G32_SINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32G32_FLOAT;
+			}
+			else if (param_desc.Mask <= 7)
+			{
+				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32G32B32_UINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32G32B32_SINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32G32B32_FLOAT;
+			}
+			else if (param_desc.Mask <= 15)
+			{
+				if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) element_desc.Format = DXGI_FORMAT_R32G32B32A32_UINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) element_desc.Format = DXGI_FORMAT_R32G32B32A32_SINT;
+				else if (param_desc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) element_desc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+			}
+
+			input_layout_desc.push_back(element_desc);
+		}
+
+		if (m_type == Shader::Type::Vertex)
+		{
+			camy_assert(!input_layout_desc.empty(), , "Vertex shader with no input layout?");
+
+			// Todo : this is to allow for interleaved data, position is set to 0, all the rest is incremeneted by 1
+			input_layout_desc[0].InputSlot = 0;
+			for (auto i{ 1u }; i < input_layout_desc.size(); ++i)
+				input_layout_desc[i].InputSlot = 1;
+
+			// Per instance inputs come from their own stream, advancing once per instance
+			for (auto& element : input_layout_desc)
+			{
+				if (std::strncmp(element.SemanticName, features::instance_semantic, sizeof(features::instance_semantic) - 1) == 0)
+				{
+					element.InputSlot = features::instance_buffer_slot;
+					element.InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+					element.InstanceDataStepRate = 1;
+				}
+			}
+
+			m_input_signature = hidden::gpu.create_input_signature(compiled_bytecode, bytecode_size, &input_layout_desc[0], input_layout_desc.size());
+			if (m_input_signature == nullptr)
+			{
+				camy_error("Failed to create input signature for shader");
+				safe_release_com(shader_reflection);
+				return false;
+			}
+		}
+
+		safe_release_com(shader_reflection);
+		return true;
+	}
+#endif
+}
@@ -0,0 +1,454 @@
+// Header
+#include <camy/software_rasterizer.hpp>
+
+// camy
+#include <camy/error.hpp>
+#include <camy/layers.hpp>
+
+// C++ STL
+#undef min
+#undef max
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// SSE2 is the baseline on x64
+#include <emmintrin.h>
+
+namespace camy
+{
+	namespace
+	{
+		// Clip space outcodes, D3D volume: -w <= x, y <= w, 0 <= z <= w
+		u32 compute_outcode(const float* v)
+		{
+			return (v[0] < -v[3]) | (v[0] > v[3]) << 1 | (v[1] < -v[3]) << 2 | (v[1] > v[3]) << 3 | (v[2] < 0.f) << 4 | (v[2] > v[3]) << 5;
+		}
+		const u32 outcode_near{ 1 << 4 };
+
+		// Sutherland-Hodgman against z = 0, returns the number of vertices written to out ( at most 4 )
+		u32 clip_near(const float (*in)[4], float (*out)[4])
+		{
+			u32 num_out{ 0 };
+			for (auto i{ 0u }; i < 3; ++i)
+			{
+				const auto& cur{ in[i] };
+				const auto& next{ in[(i + 1) % 3] };
+
+				if (cur[2] >= 0.f)
+					std::memcpy(out[num_out++], cur, sizeof(float) * 4);
+
+				if ((cur[2] >= 0.f) != (next[2] >= 0.f))
+				{
+					const float t{ cur[2] / (cur[2] - next[2]) };
+					for (auto c{ 0u }; c < 4; ++c)
+						out[num_out][c] = cur[c] + (next[c] - cur[c]) * t;
+					out[num_out][2] = 0.f;
+					++num_out;
+				}
+			}
+
+			return num_out;
+		}
+
+		void multiply(const float (*left)[4], const float (*right)[4], float (*out)[4])
+		{
+			for (auto r{ 0u }; r < 4; ++r)
+			{
+				for (auto c{ 0u }; c < 4; ++c)
+					out[r][c] = left[r][0] * right[0][c] + left[r][1] * right[1][c] + left[r][2] * right[2][c] + left[r][3] * right[3][c];
+			}
+		}
+	}
+
+	SoftwareRasterizer::SoftwareRasterizer() :
+		m_width{ 0 },
+		m_height{ 0 },
+		m_pitch{ 0 },
+		m_num_tiles_x{ 0 },
+		m_num_tiles_y{ 0 },
+		m_view_projection{ float4x4_default },
+		m_num_skipped_draws{ 0 },
+		m_workers{ nullptr }
+	{
+
+	}
+
+	SoftwareRasterizer::~SoftwareRasterizer()
+	{
+		delete m_workers;
+	}
+
+	bool SoftwareRasterizer::resize(u32 width, u32 height)
+	{
+		if (width == 0 || height == 0)
+		{
+			camy_error("Can't resize software rasterizer to: ", width, "x", height);
+			return false;
+		}
+
+		m_width = width;
+		m_height = height;
+
+		// Rows are padded to the SIMD width, the last group of a row never writes past it
+		m_pitch = (width + 3) & ~3u;
+		m_depth.resize(m_pitch * height);
+
+		m_num_tiles_x = (width + tile_width - 1) / tile_width;
+		m_num_tiles_y = (height + tile_height - 1) / tile_height;
+
+		return true;
+	}
+
+	void SoftwareRasterizer::set_num_workers(u32 num_workers)
+	{
+		if (num_workers == get_num_workers())
+			return;
+
+		delete m_workers;
+		m_workers = num_workers > 0 ? new WorkerPool(num_workers) : nullptr;
+	}
+
+	void SoftwareRasterizer::clear(float depth)
+	{
+		std::fill(m_depth.begin(), m_depth.end(), depth);
+	}
+
+	void SoftwareRasterizer::set_view_projection(const float4x4& view_projection)
+	{
+		m_view_projection = view_projection;
+	}
+
+	void SoftwareRasterizer::draw(const RenderItem& render_item, const float4x4* world)
+	{
+		const auto vertex_buffer{ render_item.vertex_buffer1 };
+		const auto index_buffer{ render_item.index_buffer };
+		const auto& draw_info{ render_item.draw_info };
+
+		if (draw_info.primitive_topology != PrimitiveTopology::TriangleList ||
+			vertex_buffer == nullptr || vertex_buffer->cpu_data == nullptr || vertex_buffer->element_size < sizeof(float3) ||
+			index_buffer == nullptr || index_buffer->cpu_data == nullptr ||
+			draw_info.index_offset + draw_info.index_count > index_buffer->element_count)
+		{
+			++m_num_skipped_draws;
+			return;
+		}
+
+		Draw draw;
+		if (world != nullptr)
+			multiply(world->m, m_view_projection.m, draw.world_view_projection);
+		else
+			std::memcpy(draw.world_view_projection, m_view_projection.m, sizeof(draw.world_view_projection));
+
+		draw.positions = static_cast<const Byte*>(vertex_buffer->cpu_data);
+		draw.stride = vertex_buffer->element_size;
+		draw.num_vertices = vertex_buffer->element_count;
+		draw.indices = index_buffer->cpu_data;
+		draw.is_u32 = index_buffer->index_type == IndexBuffer::Type::U32;
+		draw.draw_info = draw_info;
+
+		// Same default as the device, back faces are culled
+		const auto rasterizer_state{ render_item.common_states != nullptr ? render_item.common_states->rasterizer_state : nullptr };
+		const auto cull{ rasterizer_state != nullptr ? rasterizer_state->cull : RasterizerState::Cull::Back };
+		draw.cull_back = cull == RasterizerState::Cull::Back;
+		draw.cull_front = cull == RasterizerState::Cull::Front;
+
+		const auto draw_index{ static_cast<u32>(m_draws.size()) };
+		m_draws.push_back(draw);
+
+		const auto num_triangles{ draw_info.index_count / 3 };
+		for (auto first{ 0u }; first < num_triangles; first += max_triangles_per_task)
+			m_setup_tasks.push_back({ draw_index, first, std::min(static_cast<u32>(max_triangles_per_task), num_triangles - first) });
+	}
+
+	void SoftwareRasterizer::draw(const RenderLayer& render_layer)
+	{
+		const bool world_as_instance_data{ render_layer.get_instance_data_size() == sizeof(float4x4) };
+
+		for (auto rq{ 0u }; rq < render_layer.get_num_render_queues(); ++rq)
+		{
+			const auto& render_queue{ render_layer.get_render_queues()[rq] };
+
+			const auto render_items{ render_queue.get_items() };
+			const auto num_render_items{ render_queue.get_num_sort_entries() };
+
+			// Null if the items have already been moved in sorted order, retained queues have holes
+			// and can only be walked through the entries
+			const auto sort_entries{ render_queue.get_sort_entries() };
+
+			if (render_items == nullptr)
+				continue;
+
+			for (auto i{ 0u }; i < num_render_items; ++i)
+			{
+				const auto& render_item{ sort_entries == nullptr ? render_items[i] : render_items[sort_entries[i].index] };
+				draw(render_item, world_as_instance_data ? static_cast<const float4x4*>(render_item.instance_data) : nullptr);
+			}
+		}
+	}
+
+	void SoftwareRasterizer::flush()
+	{
+		if (m_depth.empty())
+		{
+			camy_warning("Flushing software rasterizer with no target, call resize() first");
+			m_draws.clear();
+			m_setup_tasks.clear();
+			m_num_skipped_draws = 0;
+			return;
+		}
+
+		const auto num_threads{ get_num_workers() + 1 };
+		const auto num_tiles{ m_num_tiles_x * m_num_tiles_y };
+
+		// Bins keep their memory across flushes
+		m_thread_bins.resize(num_threads);
+		for (auto& bins : m_thread_bins)
+		{
+			bins.triangles.clear();
+			bins.tiles.resize(num_tiles);
+			for (auto& tile : bins.tiles)
+				tile.clear();
+			bins.stats = Stats();
+		}
+
+		auto setup = [this](u32 task, u32 thread_index) { _setup(m_setup_tasks[task], m_thread_bins[thread_index]); };
+		auto rasterize = [this](u32 tile, u32 thread_index) { _rasterize(tile); };
+
+		const auto num_setup_tasks{ static_cast<u32>(m_setup_tasks.size()) };
+		if (m_workers != nullptr)
+		{
+			m_workers->run(num_setup_tasks, setup);
+			m_workers->run(num_tiles, rasterize);
+		}
+		else
+		{
+			for (auto i{ 0u }; i < num_setup_tasks; ++i)
+				setup(i, 0);
+			for (auto i{ 0u }; i < num_tiles; ++i)
+				rasterize(i, 0);
+		}
+
+		m_stats = Stats();
+		m_stats.num_draws = static_cast<u32>(m_draws.size());
+		m_stats.num_skipped_draws = m_num_skipped_draws;
+		for (const auto& bins : m_thread_bins)
+		{
+			m_stats.num_triangles += bins.stats.num_triangles;
+			m_stats.num_culled_triangles += bins.stats.num_culled_triangles;
+			m_stats.num_clipped_triangles += bins.stats.num_clipped_triangles;
+			m_stats.num_binned_triangles += bins.stats.num_binned_triangles;
+		}
+
+		m_draws.clear();
+		m_setup_tasks.clear();
+		m_num_skipped_draws = 0;
+	}
+
+	void SoftwareRasterizer::_setup(const SetupTask& task, ThreadBins& bins)
+	{
+		const auto& draw{ m_draws[task.draw] };
+
+		const __m128 row0{ _mm_loadu_ps(draw.world_view_projection[0]) };
+		const __m128 row1{ _mm_loadu_ps(draw.world_view_projection[1]) };
+		const __m128 row2{ _mm_loadu_ps(draw.world_view_projection[2]) };
+		const __m128 row3{ _mm_loadu_ps(draw.world_view_projection[3]) };
+
+		const auto indices16{ static_cast<const u16*>(draw.indices) + draw.draw_info.index_offset };
+		const auto indices32{ static_cast<const u32*>(draw.indices) + draw.draw_info.index_offset };
+
+		for (auto t{ task.first_triangle }; t < task.first_triangle + task.num_triangles; ++t)
+		{
+			++bins.stats.num_triangles;
+
+			float clip[3][4];
+			bool valid{ true };
+			for (auto v{ 0u }; v < 3; ++v)
+			{
+				const auto index{ (draw.is_u32 ? indices32[t * 3 + v] : indices16[t * 3 + v]) + draw.draw_info.vertex_offset };
+				if (index >= draw.num_vertices)
+				{
+					valid = false;
+					break;
+				}
+
+				auto position{ reinterpret_cast<const float*>(draw.positions + index * draw.stride) };
+				__m128 result{ _mm_mul_ps(_mm_set1_ps(position[0]), row0) };
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(position[1]), row1));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(position[2]), row2));
+				result = _mm_add_ps(result, row3);
+				_mm_storeu_ps(clip[v], result);
+			}
+
+			if (!valid)
+			{
+				++bins.stats.num_culled_triangles;
+				continue;
+			}
+
+			_bin(clip, draw, bins);
+		}
+	}
+
+	void SoftwareRasterizer::_bin(const float (*clip)[4], const Draw& draw, ThreadBins& bins)
+	{
+		const u32 outcodes[3]{ compute_outcode(clip[0]), compute_outcode(clip[1]), compute_outcode(clip[2]) };
+		if (outcodes[0] & outcodes[1] & outcodes[2])
+		{
+			++bins.stats.num_culled_triangles;
+			return;
+		}
+
+		// Only the near plane is clipped, after it w > 0 and the rest is handled by the pixel bounds
+		// and the depth test ( z > 1 never passes a buffer cleared to 1 )
+		float polygon[4][4];
+		u32 num_vertices{ 3 };
+		if ((outcodes[0] | outcodes[1] | outcodes[2]) & outcode_near)
+		{
+			++bins.stats.num_clipped_triangles;
+			num_vertices = clip_near(clip, polygon);
+		}
+		else
+			std::memcpy(polygon, clip, sizeof(float) * 4 * 3);
+
+		const auto width{ static_cast<float>(m_width) };
+		const auto height{ static_cast<float>(m_height) };
+
+		// Pixel coordinates, y down
+		float x[4], y[4], z[4];
+		for (auto v{ 0u }; v < num_vertices; ++v)
+		{
+			const float inv_w{ 1.f / polygon[v][3] };
+			x[v] = (polygon[v][0] * inv_w * 0.5f + 0.5f) * width;
+			y[v] = (0.5f - polygon[v][1] * inv_w * 0.5f) * height;
+			z[v] = polygon[v][2] * inv_w;
+		}
+
+		// Fan
+		bool binned{ false };
+		for (auto v{ 1u }; v + 1 < num_vertices; ++v)
+		{
+			u32 i0{ 0 }, i1{ v }, i2{ v + 1 };
+
+			// Positive if clockwise, which is front facing
+			const float area{ (x[i1] - x[i0]) * (y[i2] - y[i0]) - (x[i2] - x[i0]) * (y[i1] - y[i0]) };
+			if (!(area != 0.f) || (area > 0.f && draw.cull_front) || (area < 0.f && draw.cull_back))
+				continue;
+
+			if (area < 0.f)
+				std::swap(i1, i2);
+			const float abs_area{ std::abs(area) };
+
+			const float min_xf{ std::min(x[i0], std::min(x[i1], x[i2])) };
+			const float max_xf{ std::max(x[i0], std::max(x[i1], x[i2])) };
+			const float min_yf{ std::min(y[i0], std::min(y[i1], y[i2])) };
+			const float max_yf{ std::max(y[i0], std::max(y[i1], y[i2])) };
+
+			// Pixels whose center is inside the bounds, clamped to the target before converting
+			Triangle triangle;
+			triangle.min_x = static_cast<i32>(std::ceil(std::min(std::max(min_xf - 0.5f, 0.f), width)));
+			triangle.max_x = static_cast<i32>(std::floor(std::max(std::min(max_xf - 0.5f, width - 1.f), -1.f)));
+			triangle.min_y = static_cast<i32>(std::ceil(std::min(std::max(min_yf - 0.5f, 0.f), height)));
+			triangle.max_y = static_cast<i32>(std::floor(std::max(std::min(max_yf - 0.5f, height - 1.f), -1.f)));
+			if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y)
+				continue;
+
+			// Edges are evaluated at pixel centers, the half pixel offset is folded into c
+			const u32 vertices[3]{ i0, i1, i2 };
+			for (auto e{ 0u }; e < 3; ++e)
+			{
+				const auto from{ vertices[e] };
+				const auto to{ vertices[(e + 1) % 3] };
+
+				triangle.a[e] = y[from] - y[to];
+				triangle.b[e] = x[to] - x[from];
+				triangle.c[e] = -(triangle.a[e] * x[from] + triangle.b[e] * y[from]) + 0.5f * (triangle.a[e] + triangle.b[e]);
+			}
+
+			// z / w is linear in screen space
+			triangle.dzdx = ((z[i1] - z[i0]) * (y[i2] - y[i0]) - (z[i2] - z[i0]) * (y[i1] - y[i0])) / abs_area;
+			triangle.dzdy = ((z[i2] - z[i0]) * (x[i1] - x[i0]) - (z[i1] - z[i0]) * (x[i2] - x[i0])) / abs_area;
+			triangle.z = z[i0] - triangle.dzdx * x[i0] - triangle.dzdy * y[i0] + 0.5f * (triangle.dzdx + triangle.dzdy);
+
+			const auto triangle_index{ static_cast<u32>(bins.triangles.size()) };
+			bins.triangles.push_back(triangle);
+
+			for (auto ty{ static_cast<u32>(triangle.min_y) / tile_height }; ty <= static_cast<u32>(triangle.max_y) / tile_height; ++ty)
+			{
+				for (auto tx{ static_cast<u32>(triangle.min_x) / tile_width }; tx <= static_cast<u32>(triangle.max_x) / tile_width; ++tx)
+					bins.tiles[ty * m_num_tiles_x + tx].push_back(triangle_index);
+			}
+
+			binned = true;
+		}
+
+		if (binned)
+			++bins.stats.num_binned_triangles;
+		else
+			++bins.stats.num_culled_triangles;
+	}
+
+	void SoftwareRasterizer::_rasterize(u32 tile)
+	{
+		const i32 tile_x0{ static_cast<i32>((tile % m_num_tiles_x) * tile_width) };
+		const i32 tile_y0{ static_cast<i32>((tile / m_num_tiles_x) * tile_height) };
+		const i32 tile_x1{ std::min(tile_x0 + static_cast<i32>(tile_width), static_cast<i32>(m_width)) };
+		const i32 tile_y1{ std::min(tile_y0 + static_cast<i32>(tile_height), static_cast<i32>(m_height)) };
+
+		const __m128 lane_offsets{ _mm_setr_ps(0.f, 1.f, 2.f, 3.f) };
+		const __m128 zero{ _mm_setzero_ps() };
+
+		for (const auto& bins : m_thread_bins)
+		{
+			for (auto triangle_index : bins.tiles[tile])
+			{
+				const auto& triangle{ bins.triangles[triangle_index] };
+
+				// Groups of four pixels, tiles start at a multiple of four thus groups never cross them
+				const i32 start_x{ std::max(triangle.min_x, tile_x0) & ~3 };
+				const i32 end_x{ std::min(triangle.max_x, tile_x1 - 1) };
+				const i32 start_y{ std::max(triangle.min_y, tile_y0) };
+				const i32 end_y{ std::min(triangle.max_y, tile_y1 - 1) };
+
+				const __m128 a0{ _mm_set1_ps(triangle.a[0]) };
+				const __m128 a1{ _mm_set1_ps(triangle.a[1]) };
+				const __m128 a2{ _mm_set1_ps(triangle.a[2]) };
+				const __m128 step0{ _mm_set1_ps(triangle.a[0] * 4.f) };
+				const __m128 step1{ _mm_set1_ps(triangle.a[1] * 4.f) };
+				const __m128 step2{ _mm_set1_ps(triangle.a[2] * 4.f) };
+				const __m128 dzdx{ _mm_set1_ps(triangle.dzdx) };
+				const __m128 step_z{ _mm_set1_ps(triangle.dzdx * 4.f) };
+
+				const __m128 x{ _mm_add_ps(_mm_set1_ps(static_cast<float>(start_x)), lane_offsets) };
+
+				for (auto py{ start_y }; py <= end_y; ++py)
+				{
+					const float fy{ static_cast<float>(py) };
+
+					__m128 e0{ _mm_add_ps(_mm_mul_ps(a0, x), _mm_set1_ps(triangle.b[0] * fy + triangle.c[0])) };
+					__m128 e1{ _mm_add_ps(_mm_mul_ps(a1, x), _mm_set1_ps(triangle.b[1] * fy + triangle.c[1])) };
+					__m128 e2{ _mm_add_ps(_mm_mul_ps(a2, x), _mm_set1_ps(triangle.b[2] * fy + triangle.c[2])) };
+					__m128 z{ _mm_add_ps(_mm_mul_ps(dzdx, x), _mm_set1_ps(triangle.dzdy * fy + triangle.z)) };
+
+					auto row{ &m_depth[py * m_pitch] };
+					for (auto px{ start_x }; px <= end_x; px += 4)
+					{
+						const __m128 inside{ _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero)) };
+						if (_mm_movemask_ps(inside) != 0)
+						{
+							const __m128 depth{ _mm_loadu_ps(row + px) };
+							const __m128 pixel_z{ _mm_max_ps(z, zero) };
+							const __m128 pass{ _mm_and_ps(inside, _mm_cmplt_ps(pixel_z, depth)) };
+							_mm_storeu_ps(row + px, _mm_or_ps(_mm_and_ps(pass, pixel_z), _mm_andnot_ps(pass, depth)));
+						}
+
+						e0 = _mm_add_ps(e0, step0);
+						e1 = _mm_add_ps(e1, step1);
+						e2 = _mm_add_ps(e2, step2);
+						z = _mm_add_ps(z, step_z);
+					}
+				}
+			}
+		}
+	}
+}
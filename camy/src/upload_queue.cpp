@@ -0,0 +1,203 @@
+// Header
+#include <camy/upload_queue.hpp>
+
+// camy
+#include <camy/error.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cstring>
+
+namespace camy
+{
+	UploadQueue::UploadQueue() :
+		m_pending_size{ 0 }
+	{
+
+	}
+
+	void UploadQueue::submit(VertexBuffer* vertex_buffer, const void* data, u32 size)
+	{
+		if (vertex_buffer == nullptr || data == nullptr || size == 0)
+		{
+			camy_warning("Tried to upload invalid data to vertex buffer");
+			return;
+		}
+
+		Upload upload;
+		upload.type = Type::VertexBuffer;
+		upload.resource = vertex_buffer;
+		upload.is_ready = &vertex_buffer->is_ready;
+		upload.data.resize(size);
+		std::memcpy(&upload.data[0], data, size);
+		upload.subresources.push_back({ 0, 1, size });
+
+		_submit(std::move(upload));
+	}
+
+	void UploadQueue::submit(IndexBuffer* index_buffer, const void* data, u32 size)
+	{
+		if (index_buffer == nullptr || data == nullptr || size == 0)
+		{
+			camy_warning("Tried to upload invalid data to index buffer");
+			return;
+		}
+
+		Upload upload;
+		upload.type = Type::IndexBuffer;
+		upload.resource = index_buffer;
+		upload.is_ready = &index_buffer->is_ready;
+		upload.data.resize(size);
+		std::memcpy(&upload.data[0], data, size);
+		upload.subresources.push_back({ 0, 1, size });
+
+		_submit(std::move(upload));
+	}
+
+	void UploadQueue::submit(Surface* surface, const SubSurface* subsurfaces, u32 num_subsurfaces)
+	{
+		if (surface == nullptr || subsurfaces == nullptr || num_subsurfaces == 0)
+		{
+			camy_warning("Tried to upload invalid data to surface");
+			return;
+		}
+
+		Upload upload;
+		upload.type = Type::Surface;
+		upload.resource = surface;
+		upload.is_ready = &surface->is_ready;
+
+		Size size{ 0 };
+		for (auto i{ 0u }; i < num_subsurfaces; ++i)
+		{
+			const auto& subsurface{ subsurfaces[i] };
+			if (subsurface.data == nullptr || subsurface.pitch == 0 || subsurface.size < subsurface.pitch)
+			{
+				camy_warning("Tried to upload invalid subsurface: ", i);
+				return;
+			}
+
+			upload.subresources.push_back({ size, subsurface.pitch, subsurface.size / subsurface.pitch });
+			size += subsurface.pitch * upload.subresources.back().num_rows;
+		}
+
+		upload.data.resize(size);
+		for (auto i{ 0u }; i < num_subsurfaces; ++i)
+		{
+			const auto& subresource{ upload.subresources[i] };
+			std::memcpy(&upload.data[subresource.offset], subsurfaces[i].data, subresource.pitch * subresource.num_rows);
+		}
+
+		_submit(std::move(upload));
+	}
+
+	void UploadQueue::_submit(Upload&& upload)
+	{
+		upload.next_subresource = 0;
+		upload.next_row = 0;
+		upload.submission_time = Clock::now();
+		upload.is_ready->store(false, std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_pending_size += upload.data.size();
+		m_uploads.push_back(std::move(upload));
+	}
+
+	void UploadQueue::process(u64 budget, const Copy& copy)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		Stats stats;
+		const auto now{ Clock::now() };
+		u64 remaining{ budget };
+
+		while (!m_uploads.empty())
+		{
+			auto& upload{ m_uploads.front() };
+			const auto& subresource{ upload.subresources[upload.next_subresource] };
+
+			const auto rows_left{ subresource.num_rows - upload.next_row };
+			auto num_rows{ static_cast<u32>(std::min<u64>(rows_left, remaining / subresource.pitch)) };
+			if (num_rows == 0)
+			{
+				if (stats.num_copies > 0)
+					break;
+				num_rows = 1;
+			}
+
+			Chunk chunk;
+			chunk.type = upload.type;
+			chunk.resource = upload.resource;
+			chunk.subresource = upload.next_subresource;
+			chunk.data = &upload.data[subresource.offset + static_cast<Size>(upload.next_row) * subresource.pitch];
+			chunk.pitch = subresource.pitch;
+			chunk.first_row = upload.next_row;
+			chunk.num_rows = num_rows;
+			chunk.num_subresource_rows = subresource.num_rows;
+			copy(chunk);
+
+			const u64 size{ static_cast<u64>(num_rows) * subresource.pitch };
+			remaining -= std::min(remaining, size);
+			m_pending_size -= size;
+			stats.uploaded_size += size;
+			++stats.num_copies;
+
+			upload.next_row += num_rows;
+			if (upload.next_row < subresource.num_rows)
+				continue;
+
+			upload.next_row = 0;
+			if (++upload.next_subresource < upload.subresources.size())
+				continue;
+
+			// The flag is read by other threads, the copies have been issued before
+			upload.is_ready->store(true, std::memory_order_release);
+
+			const auto latency{ std::chrono::duration<float, std::milli>(now - upload.submission_time).count() };
+			stats.average_latency += latency;
+			stats.max_latency = std::max(stats.max_latency, latency);
+			++stats.num_completed;
+
+			m_uploads.pop_front();
+		}
+
+		if (stats.num_completed > 0)
+			stats.average_latency /= stats.num_completed;
+		stats.num_pending = static_cast<u32>(m_uploads.size());
+		stats.pending_size = m_pending_size;
+		m_stats = stats;
+	}
+
+	void UploadQueue::cancel(const void* resource)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		auto upload{ std::find_if(m_uploads.begin(), m_uploads.end(), [resource](const Upload& upload) { return upload.resource == resource; }) };
+		if (upload == m_uploads.end())
+			return;
+
+		// Whatever has not been copied yet
+		for (auto i{ upload->next_subresource }; i < upload->subresources.size(); ++i)
+		{
+			const auto& subresource{ upload->subresources[i] };
+			const auto first_row{ i == upload->next_subresource ? upload->next_row : 0 };
+			m_pending_size -= static_cast<u64>(subresource.num_rows - first_row) * subresource.pitch;
+		}
+
+		m_uploads.erase(upload);
+	}
+
+	void UploadQueue::clear()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_uploads.clear();
+		m_pending_size = 0;
+		m_stats = Stats();
+	}
+
+	UploadQueue::Stats UploadQueue::get_stats()const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_stats;
+	}
+}
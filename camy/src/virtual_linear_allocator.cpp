@@ -0,0 +1,136 @@
+// Header
+#include <camy/allocators/virtual_linear_allocator.hpp>
+
+// Windows
+#include <Windows.h>
+
+namespace camy
+{
+	namespace allocators
+	{
+		VirtualLinearAllocator::VirtualLinearAllocator() :
+			m_base{ nullptr },
+			m_offset{ 0 },
+			m_committed_size{ 0 },
+			m_reserved_size{ 0 },
+			m_high_water_mark{ 0 },
+			m_large_pages{ false }
+		{
+
+		}
+
+		VirtualLinearAllocator::VirtualLinearAllocator(Size reserve_size, bool use_large_pages) :
+			VirtualLinearAllocator()
+		{
+			reserve(reserve_size, use_large_pages);
+		}
+
+		VirtualLinearAllocator::~VirtualLinearAllocator()
+		{
+			release();
+		}
+
+		bool VirtualLinearAllocator::reserve(Size reserve_size, bool use_large_pages)
+		{
+			release();
+
+			if (reserve_size == 0)
+			{
+				camy_warning("Can't reserve an empty range");
+				return false;
+			}
+
+			if (use_large_pages)
+			{
+				// Large pages have to be committed when reserving and the size has to be a multiple of the
+				// large page size. Fails without SeLockMemoryPrivilege
+				const auto large_page_size{ static_cast<Size>(GetLargePageMinimum()) };
+				if (large_page_size != 0)
+				{
+					const auto size{ (reserve_size + large_page_size - 1) / large_page_size * large_page_size };
+					m_base = static_cast<Byte*>(VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE));
+					if (m_base != nullptr)
+					{
+						m_reserved_size = m_committed_size = size;
+						m_large_pages = true;
+						return true;
+					}
+				}
+
+				camy_warning("Failed to allocate large pages ( is SeLockMemoryPrivilege held ? ), falling back to regular pages");
+			}
+
+			const auto size{ (reserve_size + commit_block_size - 1) / commit_block_size * commit_block_size };
+			m_base = static_cast<Byte*>(VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS));
+			if (m_base == nullptr)
+			{
+				camy_error("Failed to reserve address range of size: ", size, " error: ", static_cast<u32>(GetLastError()));
+				return false;
+			}
+
+			m_reserved_size = size;
+			return true;
+		}
+
+		void VirtualLinearAllocator::release()
+		{
+			if (m_base != nullptr)
+				VirtualFree(m_base, 0, MEM_RELEASE);
+
+			m_base = nullptr;
+			m_offset = 0;
+			m_committed_size = 0;
+			m_reserved_size = 0;
+			m_high_water_mark = 0;
+			m_large_pages = false;
+		}
+
+		void VirtualLinearAllocator::rewind(Size allocated_size)
+		{
+			camy_assert(allocated_size <= m_offset, { return; }, "Can't rewind forward: ", allocated_size, " current offset: ", m_offset);
+
+			if (m_offset > m_high_water_mark)
+				m_high_water_mark = m_offset;
+			m_offset = allocated_size;
+		}
+
+		void VirtualLinearAllocator::decommit()
+		{
+			if (m_base == nullptr || m_large_pages)
+				return;
+
+			const auto keep{ (m_offset + commit_block_size - 1) / commit_block_size * commit_block_size };
+			if (keep < m_committed_size)
+			{
+				VirtualFree(m_base + keep, m_committed_size - keep, MEM_DECOMMIT);
+				m_committed_size = keep;
+			}
+		}
+
+		bool VirtualLinearAllocator::_commit(Size size)
+		{
+			if (size > m_reserved_size)
+			{
+				if (m_base == nullptr)
+					camy_error("Allocating from an allocator that has not reserved any memory");
+				else
+					camy_error("Out of reserved memory, requested: ", size, " reserved: ", m_reserved_size);
+				return false;
+			}
+
+			// Always committing whole blocks to keep the number of calls low
+			auto new_committed_size{ (size + commit_block_size - 1) / commit_block_size * commit_block_size };
+			if (new_committed_size > m_reserved_size)
+				new_committed_size = m_reserved_size;
+
+			if (VirtualAlloc(m_base + m_committed_size, new_committed_size - m_committed_size, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+			{
+				camy_error("Failed to commit memory, requested: ", new_committed_size, " error: ", static_cast<u32>(GetLastError()));
+				return false;
+			}
+
+			m_committed_size = new_committed_size;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,89 @@
+// Header
+#include <camy/worker_pool.hpp>
+
+namespace camy
+{
+	WorkerPool::WorkerPool(u32 num_workers) :
+		m_task{ nullptr },
+		m_num_tasks{ 0 },
+		m_next_task{ 0 },
+		m_num_busy_workers{ 0 },
+		m_batch{ 0 },
+		m_quit{ false }
+	{
+		m_workers.reserve(num_workers);
+		for (auto i{ 0u }; i < num_workers; ++i)
+			m_workers.emplace_back(&WorkerPool::_work, this, i + 1);
+	}
+
+	WorkerPool::~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_quit = true;
+		}
+		m_wake.notify_all();
+
+		for (auto& worker : m_workers)
+			worker.join();
+	}
+
+	void WorkerPool::run(u32 num_tasks, const Task& task)
+	{
+		if (num_tasks == 0)
+			return;
+
+		// Not worth waking anybody
+		if (m_workers.empty() || num_tasks == 1)
+		{
+			for (auto i{ 0u }; i < num_tasks; ++i)
+				task(i, 0);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_task = &task;
+			m_num_tasks = num_tasks;
+			m_next_task = 0;
+			m_num_busy_workers = static_cast<u32>(m_workers.size());
+			++m_batch;
+		}
+		m_wake.notify_all();
+
+		_run_tasks(0);
+
+		// Every worker has to acknowledge the batch before the next one can start
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_done.wait(lock, [this]() { return m_num_busy_workers == 0; });
+		m_task = nullptr;
+	}
+
+	void WorkerPool::_work(u32 thread_index)
+	{
+		u64 last_batch{ 0 };
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_wake.wait(lock, [&]() { return m_quit || m_batch != last_batch; });
+				if (m_quit)
+					return;
+				last_batch = m_batch;
+			}
+
+			_run_tasks(thread_index);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (--m_num_busy_workers == 0)
+				m_done.notify_one();
+		}
+	}
+
+	void WorkerPool::_run_tasks(u32 thread_index)
+	{
+		// Tasks are picked one at a time, layers can have very different costs
+		for (auto task{ m_next_task++ }; task < m_num_tasks; task = m_next_task++)
+			(*m_task)(task, thread_index);
+	}
+}
@@ -1,4 +1,4 @@
-#pragma once
-
-#include "camy_importer/layout.hpp"
+#pragma once
+
+#include "camy_importer/layout.hpp"
 #include "camy_importer/importer.hpp"
\ No newline at end of file
@@ -1,12 +1,12 @@
-#pragma once
-
-#include "camy_render/camera.hpp"
-#include "camy_render/camera.hpp"
-
-#include "camy_render/geometries.hpp"
-#include "camy_render/vertex.hpp"
-#include "camy_render/renderer.hpp"
-
-#include "camy_render/scene_node.hpp"
-#include "camy_render/loose_octree.hpp"
+#pragma once
+
+#include "camy_render/camera.hpp"
+#include "camy_render/camera.hpp"
+
+#include "camy_render/geometries.hpp"
+#include "camy_render/vertex.hpp"
+#include "camy_render/renderer.hpp"
+
+#include "camy_render/scene_node.hpp"
+#include "camy_render/loose_octree.hpp"
 #include "camy_render/scene.hpp"
\ No newline at end of file
@@ -1,202 +1,264 @@
-// camy
-#include <camy/init.hpp>
-#include <camy/math.hpp>
-#include <camy/gpu_backend.hpp>
-
-// render
-#include "camera.hpp"
-#include "shader_common.hpp"
-
-namespace camy
-{
-	camy_inline void DepthPass::prepare(const RenderSceneNode* render_node, u32 renderable_index, RenderItem& render_item_out)
-	{
-		render_item_out.vertex_buffer1 = render_node->vertex_buffer1;
-		render_item_out.vertex_buffer2 = render_node->vertex_buffer2;
-		render_item_out.index_buffer = render_node->index_buffer;
-		render_item_out.draw_info = render_node->renderables[renderable_index].draw_info;
-
-		// Setting pipeline states
-		render_item_out.vertex_shader = &m_vertex_shader;
-		render_item_out.pixel_shader = nullptr;
-		if (m_output_view_as_rt)
-			render_item_out.pixel_shader = &m_pixel_shader;
-		render_item_out.common_states = &m_common_states;
-
-		// Creating parameters
-		auto data_parameter{ m_data_parameter_allocator.allocate<PipelineParameter>() };
-		data_parameter->shader_variable = m_per_object_var;
-		data_parameter->data = render_node->get_global_transform();
-
-		auto param_group{ m_parameter_group_allocator.allocate<ParameterGroup>() };
-		param_group->num_parameters = 1;
-		param_group->parameters = data_parameter;
-
-		// Setting parameters
-		render_item_out.cached_parameter_groups[0].parameter_group = param_group;
-		render_item_out.cached_parameter_groups[0].cache_slot = 0;
-		render_item_out.num_cached_parameter_groups = 1;
-	}
-	
-	camy_inline void LightCullingPass::prepare_single(const Buffer* lights_buffer, const Surface* view_rt, const float4x4& view, const float4x4& projection, u32 num_lights, ComputeItem& compute_item_out)
-	{
-		// Setting params
-		m_culling_dispatch_args.num_lights = num_lights;
-		math::store(m_culling_dispatch_args.projection, math::transpose(math::load (projection)));
-		math::store(m_culling_dispatch_args.view, math::transpose(math::load(view)));
-
-		m_parameters[4].data = lights_buffer;
-		m_parameters[5].data = view_rt;
-
-		// Resetting index ( There has to be a better way really, i also have to use UpdateSubResource )
-		uint data{ 0 };
-		hidden::gpu.update(m_next_light_index, &data);
-
-		// Preparing item
-		compute_item_out.compute_shader = &m_compute_shader;
-		compute_item_out.group_countx = m_culling_dispatch_args.num_tiles.x;
-		compute_item_out.group_county = m_culling_dispatch_args.num_tiles.y;
-		compute_item_out.group_countz = 1;
-		compute_item_out.key = 0;
-		compute_item_out.parameters = m_parameter_group;
-	}
-
-	camy_inline void SkyPass::prepare_single(const Camera& camera, RenderItem& render_item_out)
-	{
-		// Updating WVP values
-		math::store(m_per_frame_object.view_projection, math::transpose(math::load(camera.get_view_projection())));
-		math::store(m_per_frame_object.world, math::transpose(math::create_translation(math::load(camera.get_position()))));
-
-		render_item_out.vertex_buffer1 = m_vertex_buffer;
-		render_item_out.vertex_buffer2 = nullptr;
-		render_item_out.index_buffer = m_index_buffer;
-		render_item_out.common_states = &m_common_states;
-		render_item_out.draw_info.index_count = 36;
-		render_item_out.draw_info.index_offset =
-			render_item_out.draw_info.vertex_offset = 0;
-		render_item_out.draw_info.primitive_topology = PrimitiveTopology::TriangleList;
-		render_item_out.key = 0;
-		render_item_out.vertex_shader = &m_vertex_shader;
-		render_item_out.pixel_shader = &m_pixel_shader;
-		render_item_out.geometry_shader = nullptr;
-
-		render_item_out.num_cached_parameter_groups = 0;
-
-
-		// Sky pass is the first to run thus it's the one clearing the target surface
-		float clear_color[]{ 0.15f, 0.15f, 0.15f, 1.f };
-		hidden::gpu.clear_surface(m_common_states.render_targets[0], clear_color, 1.f, 0);
-	}
-
-	camy_inline void ForwardPass::prepare(const RenderSceneNode* render_node, u32 renderable_index, RenderItem& render_item_out)
-	{
-		render_item_out.vertex_buffer1 = render_node->vertex_buffer1;
-		render_item_out.vertex_buffer2 = render_node->vertex_buffer2;
-		render_item_out.index_buffer = render_node->index_buffer;
-		render_item_out.draw_info = render_node->renderables[renderable_index].draw_info;
-
-		// Setting pipeline states
-		render_item_out.vertex_shader = &m_vertex_shader;
-		render_item_out.pixel_shader = &m_pixel_shader;
-		render_item_out.common_states = &m_common_states;
-
-		// Setting parameters
-		// Material + World ( two different cache slots ) 
-		auto data_params{ static_cast<PipelineParameter*>(m_parameters_allocator.allocate<PipelineParameter>()) };
-		data_params->shader_variable = m_vertex_shader.get(shaders::PerObject::name);
-		data_params->data = render_node->get_global_transform();
-		
-		auto world_param_group{ m_parameter_group_allocator.allocate<ParameterGroup>() };
-		world_param_group->num_parameters = 1;
-		world_param_group->parameters = data_params;
-
-		PipelineParameter* material_params{ static_cast<PipelineParameter*>(m_parameters_allocator.allocate<PipelineParameter>()) };
-		auto material_param_count{ 0u };
-		const auto& renderable{ render_node->renderables[renderable_index] };
-		
-		if (renderable.material == nullptr)
-		{
-			camy_warning("Found renderable without material when rendering forward pass");
-		}
-		else
-		{
-			// Looking up textures and setting them as parameters, 
-			// They are part of the same parameter group as the material data 
-			auto map_count{ 0u };
-			
-			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_ColorMap) ++map_count;
-			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_MetalnessMap) ++map_count;
-			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_SmoothnessMap) ++map_count;
-
-			auto next_free{ 1u };
-			// Allocating all the maps + the cbuffer
-			// [0] is for the cbuffer, rest for maps
-			material_params = static_cast<PipelineParameter*>(m_parameters_allocator.allocate(sizeof(PipelineParameter) * (map_count + 1)));
-			material_param_count = map_count + 1;
-			auto map_params{ material_params };
-
-			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_ColorMap)
-			{
-				material_params[next_free].shader_variable = m_pixel_shader.get(shaders::names::color_map);
-				material_params[next_free].data = renderable.color_map;
-			
-
-				if (material_params[next_free].data == nullptr)
-					camy_warning("RenderFeatureSet_ColorMap is enabled, but the specified color map is null");
-
-				if (material_params[next_free].data != nullptr)
-					++next_free;
-			}
-		
-			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_MetalnessMap)
-			{
-				material_params[next_free].shader_variable = m_pixel_shader.get(shaders::names::metalness_map);
-				material_params[next_free].data = renderable.metalness_map;
-
-				if (material_params[next_free].data == nullptr)
-					camy_warning("RenderFeatureSet_MetalnessMap is enabled, but the specified metalness map is null");
-
-				if (material_params[next_free].data != nullptr)
-					++next_free;
-			}
-
-			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_SmoothnessMap)
-			{
-				material_params[next_free].shader_variable = m_pixel_shader.get(shaders::names::smoothness_map);
-				material_params[next_free].data = renderable.smoothness_map;
-
-				if (material_params[next_free].data == nullptr)
-					camy_warning("RenderFeatureSet_SmoothnessMap is enabled, but the specified smoothness map is null");
-
-				if (material_params[next_free].data != nullptr)
-					++next_free;
-			}
-		}
-
-		material_params->shader_variable = m_pixel_shader.get(shaders::Material::name);
-		material_params->data = render_node->renderables[renderable_index].material;
-
-		auto material_param_group{ m_parameter_group_allocator.allocate<ParameterGroup>() };
-		material_param_group->num_parameters = material_param_count;
-		material_param_group->parameters = material_params;
-
-		render_item_out.cached_parameter_groups[0].cache_slot = 0;
-		render_item_out.cached_parameter_groups[0].parameter_group = world_param_group;
-
-		render_item_out.cached_parameter_groups[1].cache_slot = 1;
-		render_item_out.cached_parameter_groups[1].parameter_group = material_param_group;
-
-		render_item_out.num_cached_parameter_groups = 2;
-	}
-
-	camy_inline void ForwardPass::add_light(const LightSceneNode* node)
-	{
-		camy_assert(m_next_light + 1 < m_max_lights, 
-		{
-			camy_warning("Setting too many lights, max is: ", m_max_lights);
-			return;
-		});
-
-		m_light_data[m_next_light++] = node->get_light();
-	}
+// camy
+#include <camy/init.hpp>
+#include <camy/math.hpp>
+#include <camy/gpu_backend.hpp>
+
+// render
+#include "camera.hpp"
+#include "shader_common.hpp"
+
+namespace camy
+{
+	template <typename Layout, typename Tag>
+	camy_inline RenderItem::Key keys::IdRegistry<Layout, Tag>::get(const void* resource)
+	{
+		if (resource == nullptr)
+			return 0;
+
+		auto it{ m_ids.find(resource) };
+		if (it != m_ids.end())
+			return it->second;
+
+		auto id{ static_cast<RenderItem::Key>(m_ids.size() + 1) };
+		if (!Layout::template fits<Tag>(id))
+		{
+			const RenderItem::Key max_id{ Layout::template Field<Tag>::max_value };
+			if (id == max_id + 1)
+				camy_warning("Key field is full, resources from now on share id: ", max_id);
+			id = max_id;
+		}
+
+		m_ids.emplace(resource, id);
+		return id;
+	}
+
+	camy_inline void DepthPass::prepare(const RenderSceneNode* render_node, u32 renderable_index, RenderItem& render_item_out)
+	{
+		render_item_out.vertex_buffer1 = render_node->vertex_buffer1;
+		render_item_out.vertex_buffer2 = render_node->vertex_buffer2;
+		render_item_out.index_buffer = render_node->index_buffer;
+		render_item_out.draw_info = render_node->renderables[renderable_index].draw_info;
+
+		// Setting pipeline states
+		render_item_out.vertex_shader = &m_vertex_shader;
+		render_item_out.pixel_shader = nullptr;
+		if (m_output_view_as_rt)
+			render_item_out.pixel_shader = &m_pixel_shader;
+		render_item_out.common_states = &m_common_states;
+
+		// The pipeline state is created for triangle lists, other topologies are set field by field
+		render_item_out.pipeline_state = nullptr;
+		if (m_pipeline_state != nullptr && m_pipeline_state->get_description().primitive_topology == render_item_out.draw_info.primitive_topology)
+			render_item_out.pipeline_state = m_pipeline_state;
+
+		// World matrix is streamed per instance, items of the same mesh end up in a single draw call
+		render_item_out.instance_data = render_node->get_global_transform();
+		render_item_out.num_cached_parameter_groups = 0;
+	}
+	
+	camy_inline RenderItem::Key DepthPass::compute_key(const RenderSceneNode* render_node, u32 renderable_index)
+	{
+		using Layout = keys::DepthLayout;
+
+		// View space depth of the node origin, global transforms are stored transposed
+		auto world{ render_node->get_global_transform() };
+		auto depth{ world->_14 * m_view._13 + world->_24 * m_view._23 + world->_34 * m_view._33 + m_view._43 };
+		
+		return Layout::Constant<keys::Pass, keys::depth_pass>::key |
+			Layout::pack<keys::Depth>(Layout::quantize<keys::Depth>(depth)) |
+			Layout::pack<keys::MaterialId>(m_material_ids.get(render_node->renderables[renderable_index].material)) |
+			Layout::pack<keys::VertexBufferId>(m_vertex_buffer_ids.get(render_node->vertex_buffer1));
+	}
+
+	camy_inline void LightCullingPass::prepare_single(const Buffer* lights_buffer, const Surface* view_rt, const float4x4& view, const float4x4& projection, u32 num_lights, ComputeItem& compute_item_out, CommandStream& commands)
+	{
+		// Setting params
+		m_culling_dispatch_args.num_lights = num_lights;
+		math::store(m_culling_dispatch_args.projection, math::transpose(math::load (projection)));
+		math::store(m_culling_dispatch_args.view, math::transpose(math::load(view)));
+
+		m_parameters[4].data = lights_buffer;
+		m_parameters[5].data = view_rt;
+
+		// Resetting index ( There has to be a better way really, i also have to use UpdateSubResource )
+		uint data{ 0 };
+		commands.update(m_next_light_index, &data);
+
+		// Preparing item
+		compute_item_out.compute_shader = &m_compute_shader;
+		compute_item_out.group_countx = m_culling_dispatch_args.num_tiles.x;
+		compute_item_out.group_county = m_culling_dispatch_args.num_tiles.y;
+		compute_item_out.group_countz = 1;
+		compute_item_out.key = 0;
+		compute_item_out.parameters = m_parameter_group;
+	}
+
+	camy_inline void SkyPass::prepare_single(const Camera& camera, RenderItem& render_item_out, CommandStream& commands)
+	{
+		// Updating WVP values
+		math::store(m_per_frame_object.view_projection, math::transpose(math::load(camera.get_view_projection())));
+		math::store(m_per_frame_object.world, math::transpose(math::create_translation(math::load(camera.get_position()))));
+
+		render_item_out.vertex_buffer1 = m_vertex_buffer;
+		render_item_out.vertex_buffer2 = nullptr;
+		render_item_out.index_buffer = m_index_buffer;
+		render_item_out.common_states = &m_common_states;
+		render_item_out.draw_info.index_count = 36;
+		render_item_out.draw_info.index_offset =
+			render_item_out.draw_info.vertex_offset = 0;
+		render_item_out.draw_info.primitive_topology = PrimitiveTopology::TriangleList;
+		render_item_out.key = 0;
+		render_item_out.vertex_shader = &m_vertex_shader;
+		render_item_out.pixel_shader = &m_pixel_shader;
+		render_item_out.geometry_shader = nullptr;
+		render_item_out.pipeline_state = m_pipeline_state;
+
+		render_item_out.num_cached_parameter_groups = 0;
+
+
+		// Sky pass is the first to run thus it's the one clearing the target surface
+		float clear_color[]{ 0.15f, 0.15f, 0.15f, 1.f };
+		commands.clear_surface(m_common_states.render_targets[0], clear_color, 1.f, 0);
+	}
+
+	camy_inline void ForwardPass::prepare(const RenderSceneNode* render_node, u32 renderable_index, RenderItem& render_item_out, ItemParameters* parameters, u32 thread_index)
+	{
+		render_item_out.vertex_buffer1 = render_node->vertex_buffer1;
+		render_item_out.vertex_buffer2 = render_node->vertex_buffer2;
+		render_item_out.index_buffer = render_node->index_buffer;
+		render_item_out.draw_info = render_node->renderables[renderable_index].draw_info;
+
+		// Setting pipeline states
+		render_item_out.vertex_shader = &m_vertex_shader;
+		render_item_out.pixel_shader = &m_pixel_shader;
+		render_item_out.common_states = &m_common_states;
+
+		// See DepthPass::prepare
+		render_item_out.pipeline_state = nullptr;
+		if (m_pipeline_state != nullptr && m_pipeline_state->get_description().primitive_topology == render_item_out.draw_info.primitive_topology)
+			render_item_out.pipeline_state = m_pipeline_state;
+
+		// World matrix is streamed per instance, see DepthPass::prepare
+		render_item_out.instance_data = render_node->get_global_transform();
+
+		// Setting parameters
+		const auto& renderable{ render_node->renderables[renderable_index] };
+
+		// Looking up textures, they are part of the same parameter group as the material data 
+		auto map_count{ 0u };
+		if (renderable.material != nullptr)
+		{
+			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_ColorMap) ++map_count;
+			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_MetalnessMap) ++map_count;
+			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_SmoothnessMap) ++map_count;
+		}
+
+		// Allocating all the maps + the cbuffer
+		// [0] is for the cbuffer, rest for maps
+		ParameterGroup*	   material_param_group;
+		PipelineParameter* material_params;
+		if (parameters != nullptr)
+		{
+			material_param_group = &parameters->material_parameter_group;
+			material_params = parameters->material_parameters;
+		}
+		else
+		{
+			material_param_group = m_arena->allocate<ParameterGroup>(thread_index);
+			material_params = m_arena->allocate_array<PipelineParameter>(thread_index, map_count + 1);
+		}
+		auto material_param_count{ 0u };
+		
+		if (renderable.material == nullptr)
+		{
+			camy_warning("Found renderable without material when rendering forward pass");
+		}
+		else
+		{
+			auto next_free{ 1u };
+			material_param_count = map_count + 1;
+
+			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_ColorMap)
+			{
+				material_params[next_free].shader_variable = m_color_map_var;
+				material_params[next_free].data = renderable.color_map;
+			
+
+				if (material_params[next_free].data == nullptr)
+					camy_warning("RenderFeatureSet_ColorMap is enabled, but the specified color map is null");
+
+				if (material_params[next_free].data != nullptr)
+					++next_free;
+			}
+		
+			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_MetalnessMap)
+			{
+				material_params[next_free].shader_variable = m_metalness_map_var;
+				material_params[next_free].data = renderable.metalness_map;
+
+				if (material_params[next_free].data == nullptr)
+					camy_warning("RenderFeatureSet_MetalnessMap is enabled, but the specified metalness map is null");
+
+				if (material_params[next_free].data != nullptr)
+					++next_free;
+			}
+
+			if (renderable.material->render_feature_set & shaders::RenderFeatureSet_SmoothnessMap)
+			{
+				material_params[next_free].shader_variable = m_smoothness_map_var;
+				material_params[next_free].data = renderable.smoothness_map;
+
+				if (material_params[next_free].data == nullptr)
+					camy_warning("RenderFeatureSet_SmoothnessMap is enabled, but the specified smoothness map is null");
+
+				if (material_params[next_free].data != nullptr)
+					++next_free;
+			}
+		}
+
+		material_params->shader_variable = m_material_var;
+		material_params->data = render_node->renderables[renderable_index].material;
+
+		material_param_group->num_parameters = material_param_count;
+		material_param_group->parameters = material_params;
+
+		render_item_out.cached_parameter_groups[0].cache_slot = 1;
+		render_item_out.cached_parameter_groups[0].parameter_group = material_param_group;
+
+		render_item_out.num_cached_parameter_groups = 1;
+	}
+
+	camy_inline RenderItem::Key ForwardPass::compute_key(const RenderSceneNode* render_node, u32 renderable_index)
+	{
+		using Layout = keys::ForwardLayout;
+
+		// See DepthPass::compute_key
+		auto world{ render_node->get_global_transform() };
+		auto depth{ world->_14 * m_view._13 + world->_24 * m_view._23 + world->_34 * m_view._33 + m_view._43 };
+		auto quantized_depth{ Layout::quantize<keys::Depth>(depth) };
+
+		// Translucent items are blended, state is not taken into account and they go back to front
+		if (render_node->physical_property != RenderSceneNode::PhysicalProperty::Opaque)
+		{
+			return Layout::Constant<keys::Pass, keys::forward_pass>::key |
+				Layout::Constant<keys::Translucency, 1>::key |
+				Layout::pack<keys::Depth>(Layout::Field<keys::Depth>::max_value - quantized_depth);
+		}
+
+		return Layout::Constant<keys::Pass, keys::forward_pass>::key |
+			Layout::pack<keys::MaterialId>(m_material_ids.get(render_node->renderables[renderable_index].material)) |
+			Layout::pack<keys::VertexBufferId>(m_vertex_buffer_ids.get(render_node->vertex_buffer1)) |
+			Layout::pack<keys::Depth>(quantized_depth);
+	}
+
+	camy_inline void ForwardPass::add_light(const LightSceneNode* node)
+	{
+		camy_assert(m_next_light + 1 < m_max_lights, 
+		{
+			camy_warning("Setting too many lights, max is: ", m_max_lights);
+			return;
+		});
+
+		m_light_data[m_next_light++] = node->get_light();
+	}
 }
\ No newline at end of file
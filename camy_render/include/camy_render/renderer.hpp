@@ -1,81 +1,142 @@
-#pragma once
-
-// camy
-#include <camy/layers.hpp>
-#include <camy/layer_dispatcher.hpp>
-
-// render
-#include "passes.hpp"
-#include "post_process_pipeline.hpp"
-
-// C++ STL
-#include <vector>
-
-namespace camy
-{
-	class GPUBackend;
-	class Scene;
-	class Camera;
-	struct Viewport;
-
-	/*
-		Class: Renderer
-			Actual class that is in duty of rendering, does nothing else, he receives an already processed
-			scene an renders, for more information on the technique read the Documentation
-	*/
-	class Renderer final
-	{
-	public:
-		Renderer();
-		~Renderer();
-
-		Renderer(const Renderer& other) = delete;
-		Renderer& operator=(const Renderer& other) = delete;
-
-		Renderer(Renderer&& other) = delete;
-		Renderer& operator=(Renderer&& other) = delete;
-
-		/*
-			Function: load
-				Creates all the required resources needed for rendering based on the
-				effects that are being enabled. 
-		*/
-		bool load(Surface* window_surface, const float4x4& projection, u32 effects, u32 max_lights = 10, u32 shadow_map_size = 4096);
-		void unload();
-
-		// Todo: provide default viewport value
-		void render(Scene& scene, Camera& camera); // Default viewport that corresponds to the window_surface specified in load();
-		void render(Scene& scene, Camera& camera, const Viewport& viewport);
-
-		void sync();
-
-	private:		
-		void _queue_sky(Scene& scene, Camera& camera, const Viewport& viewport);
-		void _queue_light_culling(Scene& scene, Camera& camera, const Viewport& viewport);
-
-		u32		 m_effects;
-		Surface* m_window_surface;
-		Surface* m_offscreen_target;
-		PostProcessPipeline m_post_process_pipeline;
-		
-		LayerDispatcher m_layer_dispatcher;
-		ComputeLayer m_light_culling_layer;
-		RenderLayer m_sky_layer;
-		RenderLayer m_scene_depth_layer;
-		RenderLayer m_light_depth_layer;
-		RenderLayer m_forward_layer;
-		PostProcessLayer m_pp_layer;
-
-		SkyPass m_sky_pass;
-		DepthPass m_scene_depth_pass;
-		DepthPass m_light_depth_pass;
-		LightCullingPass m_light_culling_pass;
-		ForwardPass m_forward_pass;
-
-		Dependency m_scene_depht_out;
-		Dependency m_light_depth_out;
-		Dependency m_forward_deps[4];
-
-		u32 m_max_lights;
-	};
+#pragma once
+
+// camy
+#include <camy/layers.hpp>
+#include <camy/layer_dispatcher.hpp>
+
+// render
+#include "passes.hpp"
+#include "post_process_pipeline.hpp"
+
+// C++ STL
+#include <unordered_map>
+#include <vector>
+
+namespace camy
+{
+	class GPUBackend;
+	class Scene;
+	class Camera;
+	struct Viewport;
+
+	/*
+		Class: Renderer
+			Actual class that is in duty of rendering, does nothing else, he receives an already processed
+			scene an renders, for more information on the technique read the Documentation
+	*/
+	class Renderer final
+	{
+	public:
+		Renderer();
+		~Renderer();
+
+		Renderer(const Renderer& other) = delete;
+		Renderer& operator=(const Renderer& other) = delete;
+
+		Renderer(Renderer&& other) = delete;
+		Renderer& operator=(Renderer&& other) = delete;
+
+		/*
+			Function: load
+				Creates all the required resources needed for rendering based on the
+				effects that are being enabled. 
+		*/
+		bool load(Surface* window_surface, const float4x4& projection, u32 effects, u32 max_lights = 10, u32 shadow_map_size = 4096);
+		void unload();
+
+		// Todo: provide default viewport value
+		void render(Scene& scene, Camera& camera); // Default viewport that corresponds to the window_surface specified in load();
+		void render(Scene& scene, Camera& camera, const Viewport& viewport);
+
+		/*
+			Function: sync
+				Submits the frame recorded by render() and presents it. If pipelined it only waits for
+				the frame before the previous one, the next frame is recorded while this one is being replayed
+		*/
+		void sync();
+
+		/*
+			Function: set_pipelined
+				See LayerDispatcher::set_pipelined, frames are replayed and presented by a render thread.
+				Has to be called outside render() / sync()
+		*/
+		void set_pipelined(bool pipelined);
+		bool is_pipelined()const { return m_layer_dispatcher.is_pipelined(); }
+
+		/*
+			Function: set_retained
+				In retained mode the items of the depth and forward layers persist across frames, they are built
+				once per node and only their keys are updated when the views change or the node moves. Nodes have to be 
+				tagged dirty ( RenderSceneNode::tag_dirty ) when modified. Has to be called outside render() / sync()
+		*/
+		void set_retained(bool retained);
+		bool is_retained()const { return m_retained; }
+
+	private:
+		// Items + parameters of a renderable in retained mode
+		struct RetainedRenderable
+		{
+			RenderLayer::ItemHandle scene_depth;
+			RenderLayer::ItemHandle light_depth;
+			RenderLayer::ItemHandle forward;
+
+			ForwardPass::ItemParameters forward_parameters;
+		};
+
+		// Handles are invalid for the items that didn't fit in the queues, the node is built again
+		// the next frame until all of them do
+		struct RetainedNode
+		{
+			u32 version{ 0 };
+			u32 transform_version{ 0 };
+			u32 last_frame{ 0 };
+			bool complete{ false };
+
+			// Parameters are referenced by the items, resized only after removing them
+			std::vector<RetainedRenderable> renderables;
+		};
+
+		void _declare_resources(Surface* output_surface);
+		void _queue_sky(Scene& scene, Camera& camera, const Viewport& viewport, CommandStream& frame_commands);
+		void _queue_light_culling(Scene& scene, Camera& camera, const Viewport& viewport, CommandStream& frame_commands);
+		void _queue_retained(const RenderSceneNode* render_node, bool view_changed, bool light_view_changed);
+		void _remove_retained(RetainedNode& retained_node);
+		void _release_retained();
+
+		u32		 m_effects;
+		Surface* m_window_surface;
+		Surface* m_offscreen_target;
+		PostProcessPipeline m_post_process_pipeline;
+		
+		LayerDispatcher m_layer_dispatcher;
+		ComputeLayer m_light_culling_layer;
+		RenderLayer m_sky_layer;
+		RenderLayer m_scene_depth_layer;
+		RenderLayer m_light_depth_layer;
+		RenderLayer m_forward_layer;
+		PostProcessLayer m_pp_layer;
+
+		PassArena m_pass_arena;
+		SkyPass m_sky_pass;
+		DepthPass m_scene_depth_pass;
+		DepthPass m_light_depth_pass;
+		LightCullingPass m_light_culling_pass;
+		ForwardPass m_forward_pass;
+
+		u32 m_max_lights;
+
+		bool m_retained;
+		u32	 m_frame;
+
+		// Items that didn't fit in the queues this frame ( see Queue::set_max_items ), reported once per frame
+		u32 m_num_dropped_items;
+
+		// Keyed by node handle ( SlotHandle::get_key ), a new node allocated where a destroyed one 
+		// was doesn't pick up its items
+		std::unordered_map<u64, RetainedNode> m_retained_nodes;
+
+		// Keys depend on the views, if they don't change neither do the keys
+		float4x4 m_last_view;
+		float4x4 m_last_light_view;
+	};
 }
\ No newline at end of file
@@ -1,13 +1,26 @@
-namespace camy
-{
-	template <typename NodeType>
-	NodeType* Scene::get(const char* name)
-	{
-		static_assert(std::is_base_of<SceneNode, NodeType>::value, "Invalid subnode type");
-
-		camy_assert(m_nodes_map.find(name) == m_nodes_map.end(), { return nullptr; },
-			"Failed to find node :", name, " returning null");
-
-		return static_cast<NodeType*>(m_nodes_map[name]);
-	}
+namespace camy
+{
+	template <typename NodeType>
+	NodeType* Scene::get(const char* name)
+	{
+		static_assert(std::is_base_of<SceneNode, NodeType>::value, "Invalid subnode type");
+
+		auto node{ m_nodes_map.find(name) };
+		if (node == m_nodes_map.end())
+		{
+			camy_warning("Failed to find node :", name, " returning null");
+			return nullptr;
+		}
+
+		return resolve<NodeType>(node->second);
+	}
+
+	template <typename NodeType>
+	NodeType* Scene::resolve(SlotHandle handle)const
+	{
+		static_assert(std::is_base_of<SceneNode, NodeType>::value, "Invalid subnode type");
+
+		auto node{ m_nodes.get(handle) };
+		return node != nullptr ? static_cast<NodeType*>(*node) : nullptr;
+	}
 }
\ No newline at end of file
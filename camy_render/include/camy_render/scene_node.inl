@@ -1,22 +1,32 @@
-namespace camy
-{
-	camy_inline void LightSceneNode::relocate()
-	{
-		// TODO: Properly fix relocation
-	}
-
-	camy_inline void RenderSceneNode::relocate()
-	{
-	}
-
-	camy_inline const float4x4* RenderSceneNode::get_global_transform()const
-	{
-		camy_assert(parent != nullptr, { return nullptr; },
-			"Parent of the current node is invalid");
-
-		camy_assert(parent->get_type() == SceneNode::Type::Transform, { return nullptr; },
-			"Parent of the current node is not a transform, something went wrong in the creation process");
-		
-		return static_cast<TransformSceneNode*>(parent)->get_global_transform();
-	}
+namespace camy
+{
+	camy_inline void LightSceneNode::relocate()
+	{
+		// TODO: Properly fix relocation
+	}
+
+	camy_inline void RenderSceneNode::relocate()
+	{
+		++transform_version;
+
+		auto world{ get_global_transform() };
+		if (world == nullptr)
+			return;
+
+		// Global transforms are stored transposed ( see TransformSceneNode::_validate_subtree ), translation is the last column
+		auto bounding_sphere{ spatial_object.get_bounding_sphere() };
+		bounding_sphere.center = float3{ world->_14, world->_24, world->_34 };
+		spatial_object.relocate(bounding_sphere);
+	}
+
+	camy_inline const float4x4* RenderSceneNode::get_global_transform()const
+	{
+		camy_assert(parent != nullptr, { return nullptr; },
+			"Parent of the current node is invalid");
+
+		camy_assert(parent->get_type() == SceneNode::Type::Transform, { return nullptr; },
+			"Parent of the current node is not a transform, something went wrong in the creation process");
+		
+		return static_cast<TransformSceneNode*>(parent)->get_global_transform();
+	}
 }
\ No newline at end of file
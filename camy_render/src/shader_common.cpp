@@ -1,19 +1,19 @@
-// Header
-#include <camy_render/shader_common.hpp>
-
-namespace camy
-{
-	namespace shaders
-	{
-		const char* PerFrame::name{ "PerFrame" };
-		const char* PerFrameView::name{ "PerFrameView" };
-		const char* PerFrameLight::name{ "PerFrameLight" };
-		const char* PerObject::name{ "PerObject" };
-		const char* PerFrameAndObject::name{ "PerFrameAndObject" };
-		const char* Material::name{ "Material" };
-		const char* Environment::name{ "Environment" };
-		const char* CullingDispatchArgs::name{ "CullingDispatchArgs" };
-		const char* LuminanceDownsampleArgs::name{ "LuminanceDownsampleArgs" };
-		const char* KawaseBlurArgs::name{ "KawaseBlurArgs" };
-	}
+// Header
+#include <camy_render/shader_common.hpp>
+
+namespace camy
+{
+	namespace shaders
+	{
+		constexpr ShaderVariableName PerFrame::name;
+		constexpr ShaderVariableName PerFrameView::name;
+		constexpr ShaderVariableName PerFrameLight::name;
+		constexpr ShaderVariableName PerObject::name;
+		constexpr ShaderVariableName PerFrameAndObject::name;
+		constexpr ShaderVariableName Material::name;
+		constexpr ShaderVariableName Environment::name;
+		constexpr ShaderVariableName CullingDispatchArgs::name;
+		constexpr ShaderVariableName LuminanceDownsampleArgs::name;
+		constexpr ShaderVariableName KawaseBlurArgs::name;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <camy.hpp>
+#include <camy/software_rasterizer.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/*
+	Function: check_software_rasterizer
+		Compares SoftwareRasterizer against a double precision scalar reference, single and multithreaded, and
+		draws a retained layer with holes. Run by passing --check-rasterizer, nothing in the sample sets cpu_data
+*/
+inline bool check_software_rasterizer()
+{
+	using namespace camy;
+
+	const u32 width{ 333 };
+	const u32 height{ 217 };
+	const u32 num_triangles{ 3000 };
+
+	float4x4 identity{ float4x4_default };
+
+	// Random triangles in front of the near plane, partially outside of the viewport
+	std::mt19937 generator{ 1 };
+	std::uniform_real_distribution<float> xy_distribution{ -1.2f, 1.2f };
+	std::uniform_real_distribution<float> z_distribution{ 0.05f, 0.95f };
+
+	std::vector<float3> positions(num_triangles * 3);
+	std::vector<u32> indices(num_triangles * 3);
+	for (auto i{ 0u }; i < num_triangles * 3; ++i)
+	{
+		positions[i] = float3{ xy_distribution(generator), xy_distribution(generator), z_distribution(generator) };
+		indices[i] = i;
+	}
+
+	VertexBuffer vertex_buffer;
+	vertex_buffer.element_size = sizeof(float3);
+	vertex_buffer.element_count = num_triangles * 3;
+	vertex_buffer.cpu_data = positions.data();
+
+	IndexBuffer index_buffer;
+	index_buffer.index_type = IndexBuffer::Type::U32;
+	index_buffer.element_count = num_triangles * 3;
+	index_buffer.cpu_data = indices.data();
+
+	// Random winding, nothing is culled
+	RasterizerState rasterizer_state;
+	rasterizer_state.cull = RasterizerState::Cull::None;
+	CommonStates common_states;
+	common_states.rasterizer_state = &rasterizer_state;
+
+	RenderItem render_item;
+	render_item.vertex_buffer1 = &vertex_buffer;
+	render_item.index_buffer = &index_buffer;
+	render_item.common_states = &common_states;
+	render_item.draw_info.index_count = num_triangles * 3;
+	render_item.draw_info.primitive_topology = PrimitiveTopology::TriangleList;
+
+	SoftwareRasterizer single_threaded;
+	single_threaded.resize(width, height);
+	single_threaded.set_view_projection(identity);
+	single_threaded.clear();
+	single_threaded.draw(render_item);
+	single_threaded.flush();
+
+	SoftwareRasterizer multi_threaded;
+	multi_threaded.resize(width, height);
+	multi_threaded.set_num_workers(3);
+	multi_threaded.set_view_projection(identity);
+	multi_threaded.clear();
+	multi_threaded.draw(render_item);
+	multi_threaded.flush();
+
+	// Reference, pixel centers against the edge functions of each triangle
+	std::vector<double> reference(width * height, 1.0);
+	for (auto t{ 0u }; t < num_triangles; ++t)
+	{
+		double x[3], y[3], z[3];
+		for (auto v{ 0u }; v < 3; ++v)
+		{
+			const auto& position{ positions[t * 3 + v] };
+			x[v] = (position.x * 0.5 + 0.5) * width;
+			y[v] = (0.5 - position.y * 0.5) * height;
+			z[v] = position.z;
+		}
+
+		const auto area{ (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]) };
+		if (area == 0.0)
+			continue;
+
+		for (auto py{ 0u }; py < height; ++py)
+		{
+			for (auto px{ 0u }; px < width; ++px)
+			{
+				const auto cx{ px + 0.5 };
+				const auto cy{ py + 0.5 };
+				const auto l0{ ((x[1] - cx) * (y[2] - cy) - (x[2] - cx) * (y[1] - cy)) / area };
+				const auto l1{ ((x[2] - cx) * (y[0] - cy) - (x[0] - cx) * (y[2] - cy)) / area };
+				const auto l2{ 1.0 - l0 - l1 };
+
+				if (l0 >= 0.0 && l1 >= 0.0 && l2 >= 0.0)
+					reference[py * width + px] = std::min(reference[py * width + px], l0 * z[0] + l1 * z[1] + l2 * z[2]);
+			}
+		}
+	}
+
+	// Pixels exactly on an edge can go either way, they are allowed to differ
+	auto num_wrong_pixels{ 0u };
+	auto num_thread_mismatches{ 0u };
+	auto max_error{ 0.0 };
+	for (auto py{ 0u }; py < height; ++py)
+	{
+		for (auto px{ 0u }; px < width; ++px)
+		{
+			const auto error{ std::fabs(single_threaded.get_depth(px, py) - reference[py * width + px]) };
+			if (error > 1e-3)
+				++num_wrong_pixels;
+			else
+				max_error = std::max(max_error, error);
+
+			if (single_threaded.get_depth(px, py) != multi_threaded.get_depth(px, py))
+				++num_thread_mismatches;
+		}
+	}
+
+	std::cout << "Software rasterizer | wrong pixels: " << num_wrong_pixels << " / " << width * height <<
+		" max error: " << max_error << " thread mismatches: " << num_thread_mismatches << std::endl;
+
+	if (num_wrong_pixels > width * height / 1000 || num_thread_mismatches > 0)
+		return false;
+
+	// Retained layer whose first slot has been removed, only the live items are drawn
+	RenderLayer layer{ RenderLayer::Order::Ordered, 0, 1 };
+	layer.set_retained(true);
+	layer.begin();
+
+	RenderLayer::ItemHandle handles[3];
+	for (auto i{ 0u }; i < 3; ++i)
+	{
+		handles[i] = layer.add_render_item(0, i);
+		auto retained_item{ layer.get_render_item(0, handles[i]) };
+		if (retained_item == nullptr)
+			return false;
+
+		*retained_item = render_item;
+		retained_item->draw_info.index_offset = i * 3;
+		retained_item->draw_info.index_count = 3;
+	}
+
+	// Would be counted as skipped if the dead slot was read
+	layer.get_render_item(0, handles[0])->vertex_buffer1 = nullptr;
+	layer.remove_render_item(0, handles[0]);
+	layer.end(0);
+
+	single_threaded.clear();
+	single_threaded.draw(layer);
+	single_threaded.flush();
+	layer.tag_executed();
+
+	const auto& stats{ single_threaded.get_stats() };
+	std::cout << "Software rasterizer | retained draws: " << stats.num_draws << " triangles: " << stats.num_triangles << std::endl;
+
+	return stats.num_draws == 2 && stats.num_skipped_draws == 0;
+}
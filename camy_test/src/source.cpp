@@ -8,10 +8,14 @@
 #include <chrono>
 #include <algorithm>
 #include <vector>
+#include <cstring>
 
 // Simple helper that creates a window
 #include "../include/window.hpp"
 
+// Software rasterizer against its reference
+#include "../include/rasterizer_check.hpp"
+
 // Globals
 HWND			g_window_handle;
 camy::Surface*  g_window_surface;
@@ -86,6 +90,9 @@ int main(int argc, char* argv[])
 	using namespace allocators;
 	using namespace DirectX;
 
+	if (argc > 1 && std::strcmp(argv[1], "--check-rasterizer") == 0)
+		return at_exit(check_software_rasterizer() ? EXIT_SUCCESS : EXIT_FAILURE);
+
 	camy::init();
 	GPUBackend& gpu = hidden::gpu;
 
@@ -115,6 +122,12 @@ int main(int argc, char* argv[])
 	if (!renderer.load(g_window_surface, camera.get_projection(), PostProcessPipeline::Effects_HDR | PostProcessPipeline::Effects_Bloom))
 		return at_exit(EXIT_FAILURE);
 
+	// Render nodes are not modified after loading, items can be kept across frames
+	renderer.set_retained(true);
+
+	// Next frame is recorded while the current one is being submitted
+	renderer.set_pipelined(true);
+
 	// Setting sunlight
 	/*
 	scene.set_shadow_casting_light_enabled(true);
@@ -140,7 +153,7 @@ int main(int argc, char* argv[])
 		// Renders the scene from the current camera
 		renderer.render(scene, camera, viewport);
 
-		// Waits the end of the frame and all operations, in addition it swaps buffers
+		// Submits the frame, it's presented by the render thread
 		renderer.sync();
 
 		auto end{ std::chrono::high_resolution_clock::now() };